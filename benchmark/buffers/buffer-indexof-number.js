@@ -5,13 +5,21 @@ const path = require('path');
 
 const bench = common.createBenchmark(main, {
   value: ['@'.charCodeAt(0)],
+  size: [0, 16],
   n: [1e6],
+}, {
+  // The fast API variants are only used with this flag in V8 10.2.
+  flags: ['--turbo-fast-api-calls'],
 });
 
-function main({ n, value }) {
-  const aliceBuffer = fs.readFileSync(
+function main({ n, value, size }) {
+  let aliceBuffer = fs.readFileSync(
     path.resolve(__dirname, '../fixtures/alice.html'),
   );
+  // Short buffers measure the overhead of calling into the binding, 0 searches
+  // the whole file.
+  if (size !== 0)
+    aliceBuffer = aliceBuffer.subarray(0, size);
 
   let count = 0;
   bench.start();
@@ -0,0 +1,27 @@
+'use strict';
+const common = require('../common.js');
+const { isAscii, isUtf8 } = require('buffer');
+
+const bench = common.createBenchmark(main, {
+  method: ['isAscii', 'isUtf8'],
+  type: ['buffer', 'arraybuffer'],
+  size: [16, 512, 16386],
+  n: [1e6],
+}, {
+  // The fast API variants are only used with this flag in V8 10.2.
+  flags: ['--turbo-fast-api-calls'],
+});
+
+function main({ n, method, type, size }) {
+  const fn = method === 'isAscii' ? isAscii : isUtf8;
+  const buf = Buffer.alloc(size, 'a');
+  const input = type === 'buffer' ? buf : new Uint8Array(buf).buffer;
+
+  let count = 0;
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    if (fn(input)) count++;
+  }
+  bench.end(n);
+  return count;
+}
@@ -0,0 +1,25 @@
+'use strict';
+
+// Allocates and discards medium-sized buffers. To measure the effect of the
+// ArrayBuffer pool, compare runs with NODE_BENCHMARK_FLAGS set to
+// --array-buffer-pool-size=0 and to, for example,
+// --array-buffer-pool-size=4194304.
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  type: ['alloc', 'allocUnsafeSlow', 'ArrayBuffer'],
+  len: [2048, 8192, 16384, 65536],
+  n: [1e5],
+});
+
+function main({ len, n, type }) {
+  const fn = type === 'ArrayBuffer' ?
+    (len) => new ArrayBuffer(len) :
+    Buffer[type];
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    fn(len);
+  }
+  bench.end(n);
+}
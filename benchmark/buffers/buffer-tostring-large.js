@@ -0,0 +1,20 @@
+'use strict';
+
+const common = require('../common.js');
+
+// Large buffers are turned into external strings, which take different
+// paths than the small ones of buffer-tostring.js.
+const bench = common.createBenchmark(main, {
+  encoding: ['utf8', 'ascii', 'latin1', 'hex', 'UCS-2', 'base64'],
+  len: [1024 * 1024, 16 * 1024 * 1024],
+  n: [50],
+});
+
+function main({ encoding, len, n }) {
+  const buf = Buffer.alloc(len, 'The quick brown fox jumps over the lazy dog. ');
+
+  bench.start();
+  for (let i = 0; i < n; i += 1)
+    buf.toString(encoding);
+  bench.end(n);
+}
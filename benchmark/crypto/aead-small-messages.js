@@ -0,0 +1,57 @@
+'use strict';
+
+const common = require('../common.js');
+const {
+  createAEAD,
+  createCipheriv,
+  randomBytes,
+} = require('crypto');
+
+const bench = common.createBenchmark(main, {
+  method: ['createCipheriv', 'seal', 'sealBatch'],
+  cipher: ['aes-256-gcm', 'chacha20-poly1305'],
+  len: [64, 1024],
+  n: [1e5],
+});
+
+function main({ n, method, cipher, len }) {
+  const key = randomBytes(32);
+  const iv = randomBytes(12);
+  const aad = Buffer.alloc(16, 'z');
+  const data = Buffer.alloc(len, 'b');
+
+  switch (method) {
+    case 'createCipheriv': {
+      bench.start();
+      for (let i = 0; i < n; ++i) {
+        const c = createCipheriv(cipher, key, iv, { authTagLength: 16 });
+        c.setAAD(aad);
+        c.update(data);
+        c.final();
+        c.getAuthTag();
+      }
+      bench.end(n);
+      break;
+    }
+    case 'seal': {
+      const aead = createAEAD(cipher, key);
+      bench.start();
+      for (let i = 0; i < n; ++i)
+        aead.seal(iv, data, aad);
+      bench.end(n);
+      break;
+    }
+    case 'sealBatch': {
+      // Seal the messages in batches of 64, which includes the cost of
+      // packing them into single buffers.
+      const aead = createAEAD(cipher, key);
+      const messages = new Array(64).fill({ iv, data, aad });
+      const batches = Math.ceil(n / messages.length);
+      bench.start();
+      for (let i = 0; i < batches; ++i)
+        aead.sealBatch(messages);
+      bench.end(batches * messages.length);
+      break;
+    }
+  }
+}
@@ -0,0 +1,50 @@
+'use strict';
+
+const common = require('../common.js');
+const {
+  createHash,
+  hash,
+  hashBatch,
+} = require('crypto');
+
+const bench = common.createBenchmark(main, {
+  method: ['createHash', 'hash', 'hashBatch'],
+  type: ['string', 'buffer'],
+  length: [32, 256, 4096],
+  algo: ['sha1', 'sha256'],
+  n: [1e5],
+});
+
+function main({ n, method, type, length, algo }) {
+  const data = type === 'string' ?
+    'a'.repeat(length) :
+    Buffer.alloc(length, 'a');
+
+  switch (method) {
+    case 'createHash': {
+      bench.start();
+      for (let i = 0; i < n; ++i)
+        createHash(algo).update(data).digest('hex');
+      bench.end(n);
+      break;
+    }
+    case 'hash': {
+      bench.start();
+      for (let i = 0; i < n; ++i)
+        hash(algo, data);
+      bench.end(n);
+      break;
+    }
+    case 'hashBatch': {
+      // Hash the inputs in batches of 64, which includes the cost of
+      // packing them into a single buffer.
+      const inputs = new Array(64).fill(data);
+      const batches = Math.ceil(n / inputs.length);
+      bench.start();
+      for (let i = 0; i < batches; ++i)
+        hashBatch(algo, inputs);
+      bench.end(batches * inputs.length);
+      break;
+    }
+  }
+}
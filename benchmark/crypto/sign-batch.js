@@ -0,0 +1,56 @@
+'use strict';
+
+const common = require('../common.js');
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const fixtures_keydir = path.resolve(__dirname, '../../test/fixtures/keys/');
+
+const keyFixtures = {
+  ec: fs.readFileSync(`${fixtures_keydir}/ec_p256_private.pem`, 'utf-8'),
+  rsa: fs.readFileSync(`${fixtures_keydir}/rsa_private_2048.pem`, 'utf-8'),
+  ed25519: fs.readFileSync(`${fixtures_keydir}/ed25519_private.pem`, 'utf-8'),
+};
+
+const bench = common.createBenchmark(main, {
+  keyType: ['rsa', 'ec', 'ed25519'],
+  keyFormat: ['pem', 'keyObject'],
+  api: ['sign', 'signBatch', 'verify', 'verifyBatch'],
+  batchSize: [16, 256],
+  n: [1e2],
+});
+
+function main({ n, keyType, keyFormat, api, batchSize }) {
+  const digest = keyType === 'ed25519' ? null : 'sha256';
+  const privateKey = keyFormat === 'pem' ?
+    keyFixtures[keyType] : crypto.createPrivateKey(keyFixtures[keyType]);
+  const publicKey = keyFormat === 'pem' ?
+    crypto.createPublicKey(privateKey).export({ type: 'spki', format: 'pem' }) :
+    crypto.createPublicKey(privateKey);
+
+  const data = [];
+  for (let i = 0; i < batchSize; i++)
+    data.push(crypto.randomBytes(64));
+  const signatures = crypto.signBatch(digest, data, privateKey);
+
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    switch (api) {
+      case 'sign':
+        for (let j = 0; j < batchSize; j++)
+          crypto.sign(digest, data[j], privateKey);
+        break;
+      case 'signBatch':
+        crypto.signBatch(digest, data, privateKey);
+        break;
+      case 'verify':
+        for (let j = 0; j < batchSize; j++)
+          crypto.verify(digest, data[j], publicKey, signatures[j]);
+        break;
+      case 'verifyBatch':
+        crypto.verifyBatch(digest, data, publicKey, signatures);
+        break;
+    }
+  }
+  bench.end(n * batchSize);
+}
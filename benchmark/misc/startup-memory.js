@@ -0,0 +1,49 @@
+'use strict';
+// Measures the startup time and the resident set size after startup.
+// With `metric=rss`, the reported rate is the average RSS in kilobytes,
+// so lower is better.
+const common = require('../common.js');
+const { spawnSync } = require('child_process');
+const path = require('path');
+
+const bench = common.createBenchmark(main, {
+  script: [
+    'benchmark/fixtures/require-builtins',
+    'test/fixtures/semicolon',
+  ],
+  metric: ['time', 'rss'],
+  count: [30],
+});
+
+function spawnProcess(script) {
+  const child = spawnSync(process.execPath, [
+    '-r', script,
+    '-e', 'process.stdout.write(String(process.memoryUsage.rss()))',
+  ]);
+  if (child.status !== 0) {
+    console.log('---- STDOUT ----');
+    console.log(child.stdout.toString());
+    console.log('---- STDERR ----');
+    console.log(child.stderr.toString());
+    throw new Error(`Child process stopped with exit code ${child.status}`);
+  }
+  return Number(child.stdout.toString());
+}
+
+function main({ count, script, metric }) {
+  script = path.resolve(__dirname, '../../', `${script}.js`);
+  for (let i = 0; i < 3; i++)
+    spawnProcess(script);  // Warmup.
+
+  let rss = 0;
+  const start = process.hrtime.bigint();
+  if (metric === 'time')
+    bench.start();
+  for (let i = 0; i < count; i++)
+    rss += spawnProcess(script);
+  if (metric === 'time') {
+    bench.end(count);
+  } else {
+    bench.report(rss / count / 1024, process.hrtime.bigint() - start);
+  }
+}
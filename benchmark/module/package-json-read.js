@@ -0,0 +1,49 @@
+'use strict';
+const fs = require('fs');
+const path = require('path');
+const common = require('../common.js');
+
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  dependencies: [0, 100, 1000],
+  n: [1e3],
+}, {
+  flags: ['--expose-internals'],
+});
+
+function main({ n, dependencies }) {
+  const { read } = require('internal/modules/package_json_reader');
+
+  const pjson = {
+    name: 'package',
+    version: '1.0.0',
+    main: 'index.js',
+    type: 'commonjs',
+    exports: { '.': { import: './index.mjs', require: './index.js' } },
+    dependencies: {},
+    devDependencies: {},
+  };
+  for (let i = 0; i < dependencies; i++) {
+    pjson.dependencies[`dependency-${i}`] = `^${i}.0.0`;
+    pjson.devDependencies[`dev-dependency-${i}`] = `~${i}.0.0`;
+  }
+
+  // Every file is read once, since the results are cached per path.
+  tmpdir.refresh();
+  const source = JSON.stringify(pjson, null, 2);
+  const files = [];
+  for (let i = 0; i < n; i++) {
+    const dir = path.join(tmpdir.path, `package-${i}`);
+    fs.mkdirSync(dir);
+    fs.writeFileSync(path.join(dir, 'package.json'), source);
+    files.push(path.join(dir, 'package.json'));
+  }
+
+  bench.start();
+  for (let i = 0; i < n; i++)
+    read(files[i]);
+  bench.end(n);
+
+  tmpdir.refresh();
+}
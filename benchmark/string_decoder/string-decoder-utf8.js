@@ -0,0 +1,37 @@
+'use strict';
+const common = require('../common.js');
+const { StringDecoder } = require('string_decoder');
+
+const bench = common.createBenchmark(main, {
+  content: ['ascii', 'latin1', 'cjk', 'emoji'],
+  chunkLen: [16, 256, 4096, 65536],
+  totalLen: [1024 * 1024],
+  n: [50],
+});
+
+const TEXT = {
+  ascii: 'Blueberry jam ',
+  latin1: 'Blåbærsyltetøy ',
+  cjk: '蓝莓果酱 ',
+  emoji: '🫐🍯 ',
+};
+
+function main({ content, chunkLen, totalLen, n }) {
+  const buf = Buffer.from(
+    TEXT[content].repeat(Math.ceil(totalLen / TEXT[content].length)),
+  ).subarray(0, totalLen);
+
+  // Chunk boundaries usually split multibyte characters.
+  const chunks = [];
+  for (let i = 0; i < buf.length; i += chunkLen)
+    chunks.push(buf.subarray(i, i + chunkLen));
+
+  const decoder = new StringDecoder('utf8');
+  bench.start();
+  for (let i = 0; i < n; ++i) {
+    for (let j = 0; j < chunks.length; ++j)
+      decoder.write(chunks[j]);
+    decoder.end();
+  }
+  bench.end(n * buf.length / (1024 * 1024));
+}
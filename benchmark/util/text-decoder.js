@@ -3,16 +3,18 @@
 const common = require('../common.js');
 
 const bench = common.createBenchmark(main, {
-  encoding: ['utf-8', 'latin1', 'iso-8859-3'],
+  encoding: ['utf-8', 'utf-16le', 'latin1', 'iso-8859-3'],
   ignoreBOM: [0, 1],
   fatal: [0, 1],
+  stream: [0, 1],
   len: [256, 1024 * 16, 1024 * 512],
   n: [1e2],
   type: ['SharedArrayBuffer', 'ArrayBuffer', 'Buffer'],
 });
 
-function main({ encoding, len, n, ignoreBOM, type, fatal }) {
+function main({ encoding, len, n, ignoreBOM, type, fatal, stream }) {
   const decoder = new TextDecoder(encoding, { ignoreBOM, fatal });
+  const options = { stream: Boolean(stream) };
   let buf;
 
   switch (type) {
@@ -33,7 +35,7 @@ function main({ encoding, len, n, ignoreBOM, type, fatal }) {
   bench.start();
   for (let i = 0; i < n; i++) {
     try {
-      decoder.decode(buf);
+      decoder.decode(buf, options);
     } catch {
       // eslint-disable no-empty
     }
@@ -0,0 +1,38 @@
+'use strict';
+
+const common = require('../common');
+const { types } = require('util');
+
+// Checks that are implemented by the types binding, with a value that passes
+// and one that does not.
+const args = {
+  AnyArrayBuffer: [new ArrayBuffer(0), {}],
+  BoxedPrimitive: [Object(1), 1],
+  Date: [new Date(), {}],
+  Map: [new Map(), new Set()],
+  NativeError: [new Error(), {}],
+  Promise: [Promise.resolve(), { then() {} }],
+  Proxy: [new Proxy({}, {}), {}],
+};
+
+const bench = common.createBenchmark(main, {
+  type: Object.keys(args),
+  argument: ['true', 'false'],
+  n: [1e7],
+}, {
+  // The fast API variants are only used with this flag in V8 10.2.
+  flags: ['--turbo-fast-api-calls'],
+});
+
+function main({ type, argument, n }) {
+  const func = types[`is${type}`];
+  const arg = args[type][argument === 'true' ? 0 : 1];
+
+  let count = 0;
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    if (func(arg)) count++;
+  }
+  bench.end(n);
+  return count;
+}
@@ -0,0 +1,21 @@
+'use strict';
+const common = require('../common.js');
+const { crc32 } = require('zlib');
+
+const bench = common.createBenchmark(main, {
+  type: ['buffer', 'string'],
+  len: [16, 1024, 64 * 1024, 4 * 1024 * 1024],
+  n: [1e3],
+});
+
+function main({ type, len, n }) {
+  const data = type === 'buffer' ?
+    Buffer.alloc(len, 'a') : 'a'.repeat(len);
+  // Scale iterations down for larger inputs so each run takes similar time.
+  const iterations = Math.max(1, Math.floor(n * 1024 * 64 / len));
+  let value = 0;
+  bench.start();
+  for (let i = 0; i < iterations; i++)
+    value = crc32(data, value);
+  bench.end(iterations * len / (1024 * 1024));
+}
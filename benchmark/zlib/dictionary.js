@@ -0,0 +1,41 @@
+'use strict';
+const common = require('../common.js');
+const zlib = require('zlib');
+
+const bench = common.createBenchmark(main, {
+  dictionary: ['none', 'buffer', 'Dictionary'],
+  n: [1e5],
+});
+
+function main({ n, dictionary }) {
+  // Many small, similar JSON messages, which is where a preset dictionary
+  // helps the most.
+  const sample = JSON.stringify({
+    id: 0,
+    type: 'event',
+    user: { name: 'someone', email: 'someone@example.com' },
+    tags: ['alpha', 'beta', 'gamma'],
+  });
+  const messages = [];
+  for (let i = 0; i < 64; i++)
+    messages.push(Buffer.from(sample.replace('"id":0', `"id":${i}`)));
+
+  let opts;
+  switch (dictionary) {
+    case 'none':
+      break;
+    case 'buffer':
+      opts = { dictionary: Buffer.from(sample) };
+      break;
+    case 'Dictionary':
+      opts = { dictionary: new zlib.Dictionary(sample) };
+      break;
+    default:
+      throw new Error('Unsupported dictionary type');
+  }
+
+  bench.start();
+  for (let i = 0; i < n; ++i)
+    zlib.deflateSync(messages[i & 63], opts);
+  bench.end(n);
+}
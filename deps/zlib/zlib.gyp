@@ -68,10 +68,10 @@
                 ['OS!="win" and llvm_version=="0.0"', {
                   'cflags': [ '-march=armv8-a+aes+crc' ],
                 }],
-                ['OS=="android"', {
-                  'defines': [ 'ARMV8_OS_ANDROID' ],
-                }],
-                ['OS=="linux"', {
+                # The NDK cpufeatures library that ARMV8_OS_ANDROID relies on
+                # is not part of the build. getauxval() is available on every
+                # supported API level, so use the Linux detection instead.
+                ['OS=="linux" or OS=="android"', {
                   'defines': [ 'ARMV8_OS_LINUX' ],
                 }],
                 ['OS=="mac"', {
@@ -86,10 +86,7 @@
               'direct_dependent_settings': {
                 'defines': [ 'CRC32_ARMV8_CRC32' ],
                 'conditions': [
-                  ['OS=="android"', {
-                    'defines': [ 'ARMV8_OS_ANDROID' ],
-                  }],
-                  ['OS=="linux"', {
+                  ['OS=="linux" or OS=="android"', {
                     'defines': [ 'ARMV8_OS_LINUX' ],
                   }],
                   ['OS=="mac"', {
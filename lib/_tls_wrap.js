@@ -1465,6 +1465,12 @@ Server.prototype.setSecureContext = function(options) {
   if (options.ticketKeys)
     this.ticketKeys = options.ticketKeys;
 
+  if (options.sharedSessionCache)
+    this.sharedSessionCache = options.sharedSessionCache;
+
+  if (options.privateKeyOffload)
+    this.privateKeyOffload = options.privateKeyOffload;
+
   this.privateKeyIdentifier = options.privateKeyIdentifier;
   this.privateKeyEngine = options.privateKeyEngine;
 
@@ -1488,6 +1494,8 @@ Server.prototype.setSecureContext = function(options) {
     sessionIdContext: this.sessionIdContext,
     ticketKeys: this.ticketKeys,
     sessionTimeout: this.sessionTimeout,
+    sharedSessionCache: this.sharedSessionCache,
+    privateKeyOffload: this.privateKeyOffload,
     privateKeyIdentifier: this.privateKeyIdentifier,
     privateKeyEngine: this.privateKeyEngine,
   });
@@ -87,6 +87,7 @@ const {
   diffieHellman,
 } = require('internal/crypto/diffiehellman');
 const {
+  AEAD,
   Cipher,
   Cipheriv,
   Decipher,
@@ -99,13 +100,17 @@ const {
 } = require('internal/crypto/cipher');
 const {
   Sign,
+  signBatch,
   signOneShot,
   Verify,
+  verifyBatch,
   verifyOneShot,
 } = require('internal/crypto/sig');
 const {
   Hash,
   Hmac,
+  hash,
+  hashBatch,
 } = require('internal/crypto/hash');
 const {
   X509Certificate,
@@ -137,6 +142,10 @@ function createCipher(cipher, password, options) {
   return new Cipher(cipher, password, options);
 }
 
+function createAEAD(algorithm, key, options) {
+  return new AEAD(algorithm, key, options);
+}
+
 function createCipheriv(cipher, key, iv, options) {
   return new Cipheriv(cipher, key, iv, options);
 }
@@ -177,6 +186,7 @@ module.exports = {
   // Methods
   checkPrime,
   checkPrimeSync,
+  createAEAD,
   createCipheriv,
   createDecipheriv,
   createDiffieHellman,
@@ -197,6 +207,8 @@ module.exports = {
   getCurves,
   getDiffieHellman: createDiffieHellmanGroup,
   getHashes,
+  hash,
+  hashBatch,
   hkdf,
   hkdfSync,
   pbkdf2,
@@ -217,11 +229,13 @@ module.exports = {
   scrypt,
   scryptSync,
   sign: signOneShot,
+  signBatch,
   setEngine,
   timingSafeEqual,
   getFips,
   setFips,
   verify: verifyOneShot,
+  verifyBatch,
 
   // Classes
   Certificate,
@@ -1,18 +1,29 @@
 'use strict';
 
 const {
+  Array,
+  FunctionPrototypeCall,
+  MathMax,
   ObjectSetPrototypeOf,
   ReflectApply,
   StringPrototypeToLowerCase,
+  Symbol,
+  TypedArrayPrototypeSet,
+  Uint32Array,
+  Uint8Array,
 } = primordials;
 
 const {
+  AEADBatchJob,
+  AEADContext,
   CipherBase,
   privateDecrypt: _privateDecrypt,
   privateEncrypt: _privateEncrypt,
   publicDecrypt: _publicDecrypt,
   publicEncrypt: _publicEncrypt,
   getCipherInfo: _getCipherInfo,
+  kCryptoJobAsync,
+  kCryptoJobSync,
 } = internalBinding('crypto');
 
 const {
@@ -27,15 +38,19 @@ const {
     ERR_CRYPTO_INVALID_STATE,
     ERR_INVALID_ARG_TYPE,
     ERR_INVALID_ARG_VALUE,
+    ERR_OUT_OF_RANGE,
     ERR_UNKNOWN_ENCODING,
   },
 } = require('internal/errors');
 
 const {
+  validateArray,
   validateEncoding,
+  validateFunction,
   validateInt32,
   validateObject,
   validateString,
+  validateUint32,
 } = require('internal/validators');
 
 const {
@@ -52,9 +67,12 @@ const {
 } = require('internal/crypto/util');
 
 const {
+  isAnyArrayBuffer,
   isArrayBufferView,
 } = require('internal/util/types');
 
+const { Buffer } = require('buffer');
+
 const assert = require('internal/assert');
 
 const LazyTransform = require('internal/streams/lazy_transform');
@@ -326,7 +344,151 @@ function getCipherInfo(nameOrNid, options) {
   return ret;
 }
 
+const kAuthTagLength = Symbol('kAuthTagLength');
+const kDefaultAEADAuthTagLength = 16;
+const kMaxAEADBatchLength = 2 ** 31 - 1;
+const kEmptyAAD = new Uint8Array(0);
+
+// Packs one field of every message in a batch into a single buffer, and returns
+// it along with the offsets that delimit the values of the individual messages.
+function packAEADField(messages, field) {
+  const count = messages.length;
+  const offsets = new Uint32Array(count + 1);
+  const values = new Array(count);
+  let total = 0;
+  for (let i = 0; i < count; i++) {
+    let value = messages[i][field];
+    if (value === undefined && field === 'aad') {
+      value = kEmptyAAD;
+    } else {
+      value = getArrayBufferOrView(value, `messages[${i}].${field}`);
+      if (isAnyArrayBuffer(value))
+        value = new Uint8Array(value);
+    }
+    values[i] = value;
+    total += value.byteLength;
+    if (total > kMaxAEADBatchLength) {
+      throw new ERR_OUT_OF_RANGE(
+        `messages[*].${field}`, `<= ${kMaxAEADBatchLength} bytes`, total);
+    }
+    offsets[i + 1] = total;
+  }
+
+  const buffer = Buffer.allocUnsafe(total);
+  for (let i = 0; i < count; i++) {
+    const value = values[i];
+    TypedArrayPrototypeSet(
+      buffer,
+      new Uint8Array(value.buffer, value.byteOffset, value.byteLength),
+      offsets[i]);
+  }
+  return { buffer, offsets };
+}
+
+// Splits the output of an AEADBatchJob, which holds the results of all messages
+// back to back followed by one status byte per message.
+function unpackAEADResults(result, dataOffsets, authTagLength, encrypt) {
+  const count = dataOffsets.length - 1;
+  const output = Buffer.from(result);
+  const statusOffset = output.length - count;
+  const results = new Array(count);
+  let offset = 0;
+  for (let i = 0; i < count; i++) {
+    const dataLength = dataOffsets[i + 1] - dataOffsets[i];
+    const length = encrypt ?
+      dataLength + authTagLength :
+      MathMax(dataLength - authTagLength, 0);
+    results[i] = output[statusOffset + i] === 1 ?
+      output.subarray(offset, offset + length) :
+      null;
+    offset += length;
+  }
+  return results;
+}
+
+function runAEADBatch(aead, encrypt, messages, callback) {
+  validateArray(messages, 'messages');
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+  for (let i = 0; i < messages.length; i++)
+    validateObject(messages[i], `messages[${i}]`);
+
+  const data = packAEADField(messages, 'data');
+  const iv = packAEADField(messages, 'iv');
+  const aad = packAEADField(messages, 'aad');
+  const authTagLength = aead[kAuthTagLength];
+
+  const job = new AEADBatchJob(
+    callback === undefined ? kCryptoJobSync : kCryptoJobAsync,
+    aead[kHandle],
+    encrypt,
+    data.buffer,
+    data.offsets,
+    iv.buffer,
+    iv.offsets,
+    aad.buffer,
+    aad.offsets);
+
+  if (callback === undefined) {
+    const { 0: err, 1: result } = job.run();
+    if (err !== undefined)
+      throw err;
+    return unpackAEADResults(result, data.offsets, authTagLength, encrypt);
+  }
+
+  job.ondone = (error, result) => {
+    if (error) return FunctionPrototypeCall(callback, job, error);
+    FunctionPrototypeCall(
+      callback,
+      job,
+      null,
+      unpackAEADResults(result, data.offsets, authTagLength, encrypt));
+  };
+  job.run();
+}
+
+// Encrypts and decrypts whole messages with an AEAD cipher. Unlike Cipheriv,
+// the key schedule is computed once and reused for every message.
+class AEAD {
+  constructor(algorithm, key, options) {
+    validateString(algorithm, 'algorithm');
+    let authTagLength;
+    if (options !== undefined) {
+      validateObject(options, 'options');
+      authTagLength = options.authTagLength;
+      if (authTagLength !== undefined)
+        validateUint32(authTagLength, 'options.authTagLength');
+    }
+    key = prepareSecretKey(key, getStringOption(options, 'encoding'));
+    this[kHandle] = new AEADContext(algorithm, key, authTagLength);
+    this[kAuthTagLength] = authTagLength ?? kDefaultAEADAuthTagLength;
+  }
+
+  seal(iv, data, aad) {
+    iv = getArrayBufferOrView(iv, 'iv');
+    data = getArrayBufferOrView(data, 'data');
+    aad = aad === undefined ? kEmptyAAD : getArrayBufferOrView(aad, 'aad');
+    return this[kHandle].seal(iv, data, aad);
+  }
+
+  open(iv, data, aad) {
+    iv = getArrayBufferOrView(iv, 'iv');
+    data = getArrayBufferOrView(data, 'data');
+    aad = aad === undefined ? kEmptyAAD : getArrayBufferOrView(aad, 'aad');
+    return this[kHandle].open(iv, data, aad);
+  }
+
+  sealBatch(messages, callback) {
+    return runAEADBatch(this, true, messages, callback);
+  }
+
+  openBatch(messages, callback) {
+    return runAEADBatch(this, false, messages, callback);
+  }
+}
+
 module.exports = {
+  AEAD,
   Cipher,
   Cipheriv,
   Decipher,
@@ -1,16 +1,23 @@
 'use strict';
 
 const {
+  ArrayIsArray,
+  FunctionPrototypeCall,
   ObjectSetPrototypeOf,
   ReflectApply,
+  StringPrototypeToLowerCase,
   Symbol,
+  Uint32Array,
 } = primordials;
 
 const {
   Hash: _Hash,
   HashJob,
+  HashBatchJob,
   Hmac: _Hmac,
   kCryptoJobAsync,
+  kCryptoJobSync,
+  oneShotDigest,
 } = internalBinding('crypto');
 
 const {
@@ -18,6 +25,7 @@ const {
   getStringOption,
   jobPromise,
   normalizeHashName,
+  packBatch,
   validateMaxBufferLength,
   kHandle,
 } = require('internal/crypto/util');
@@ -28,6 +36,7 @@ const {
 
 const {
   lazyDOMException,
+  normalizeEncoding,
 } = require('internal/util');
 
 const {
@@ -39,17 +48,22 @@ const {
     ERR_CRYPTO_HASH_FINALIZED,
     ERR_CRYPTO_HASH_UPDATE_FAILED,
     ERR_INVALID_ARG_TYPE,
+    ERR_INVALID_ARG_VALUE,
+    ERR_OUT_OF_RANGE,
   },
 } = require('internal/errors');
 
 const {
   validateEncoding,
+  validateFunction,
+  validateObject,
   validateString,
   validateUint32,
 } = require('internal/validators');
 
 const {
   isArrayBufferView,
+  isUint32Array,
 } = require('internal/util/types');
 
 const LazyTransform = require('internal/streams/lazy_transform');
@@ -163,6 +177,91 @@ Hmac.prototype.digest = function digest(outputEncoding) {
 Hmac.prototype._flush = Hash.prototype._flush;
 Hmac.prototype._transform = Hash.prototype._transform;
 
+function hash(algorithm, input, outputEncoding = 'hex') {
+  validateString(algorithm, 'algorithm');
+  if (typeof input !== 'string' && !isArrayBufferView(input)) {
+    throw new ERR_INVALID_ARG_TYPE(
+      'input', ['Buffer', 'TypedArray', 'DataView', 'string'], input);
+  }
+  let normalized = outputEncoding;
+  // Fast path for the default, which needs no further validation.
+  if (outputEncoding !== 'hex') {
+    validateString(outputEncoding, 'outputEncoding');
+    normalized = normalizeEncoding(outputEncoding);
+    if (normalized === undefined) {
+      // normalizeEncoding() does not know about 'buffer'.
+      if (StringPrototypeToLowerCase(outputEncoding) !== 'buffer')
+        throw new ERR_INVALID_ARG_VALUE('outputEncoding', outputEncoding);
+      normalized = 'buffer';
+    }
+  }
+  return oneShotDigest(algorithm, input, normalized);
+}
+
+function validateBatchOffsets(offsets, byteLength) {
+  if (!isUint32Array(offsets)) {
+    if (!ArrayIsArray(offsets)) {
+      throw new ERR_INVALID_ARG_TYPE(
+        'options.offsets', ['Uint32Array', 'Array'], offsets);
+    }
+    for (let i = 0; i < offsets.length; i++)
+      validateUint32(offsets[i], `options.offsets[${i}]`);
+    offsets = new Uint32Array(offsets);
+  }
+  if (offsets.length === 0) {
+    throw new ERR_INVALID_ARG_VALUE(
+      'options.offsets', offsets, 'must contain at least one offset');
+  }
+  for (let i = 1; i < offsets.length; i++) {
+    if (offsets[i] < offsets[i - 1]) {
+      throw new ERR_INVALID_ARG_VALUE(
+        'options.offsets', offsets, 'must not decrease');
+    }
+  }
+  if (offsets[offsets.length - 1] > byteLength) {
+    throw new ERR_OUT_OF_RANGE(
+      'options.offsets', `<= ${byteLength}`, offsets[offsets.length - 1]);
+  }
+  return offsets;
+}
+
+function hashBatch(algorithm, data, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = undefined;
+  }
+  validateString(algorithm, 'algorithm');
+  if (options !== undefined)
+    validateObject(options, 'options');
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+
+  let offsets;
+  if (ArrayIsArray(data)) {
+    ({ data, offsets } = packBatch(data, 'data'));
+  } else if (isArrayBufferView(data)) {
+    offsets = validateBatchOffsets(options?.offsets, data.byteLength);
+  } else {
+    throw new ERR_INVALID_ARG_TYPE(
+      'data', ['Array', 'Buffer', 'TypedArray', 'DataView'], data);
+  }
+
+  if (callback === undefined) {
+    const job = new HashBatchJob(kCryptoJobSync, algorithm, data, offsets);
+    const { 0: err, 1: digests } = job.run();
+    if (err !== undefined)
+      throw err;
+    return Buffer.from(digests);
+  }
+
+  const job = new HashBatchJob(kCryptoJobAsync, algorithm, data, offsets);
+  job.ondone = (error, digests) => {
+    if (error) return FunctionPrototypeCall(callback, job, error);
+    FunctionPrototypeCall(callback, job, null, Buffer.from(digests));
+  };
+  job.run();
+}
+
 // Implementation for WebCrypto subtle.digest()
 
 async function asyncDigest(algorithm, data) {
@@ -189,4 +288,6 @@ module.exports = {
   Hash,
   Hmac,
   asyncDigest,
+  hash,
+  hashBatch,
 };
@@ -25,6 +25,7 @@ const {
   RandomBytesJob,
   RandomPrimeJob,
   CheckPrimeJob,
+  fillRandomFromPool,
   kCryptoJobAsync,
   kCryptoJobSync,
   secureBuffer,
@@ -67,6 +68,10 @@ const { FastBuffer } = require('internal/buffer');
 const kMaxInt32 = 2 ** 31 - 1;
 const kMaxPossibleLength = MathMin(kMaxLength, kMaxInt32);
 
+// Synchronous requests for up to this many bytes are served from a per-thread
+// pool of random data that is refilled in bulk.
+const kMaxPooledRandomBytes = 256;
+
 function assertOffset(offset, elementSize, length) {
   validateNumber(offset, 'offset');
   offset *= elementSize;
@@ -136,6 +141,11 @@ function randomFillSync(buf, offset = 0, size) {
   if (size === 0)
     return buf;
 
+  // If the pool cannot be refilled, fall through so that the job reports the
+  // error.
+  if (size <= kMaxPooledRandomBytes && fillRandomFromPool(buf, offset, size))
+    return buf;
+
   const job = new RandomBytesJob(
     kCryptoJobSync,
     buf,
@@ -1,9 +1,12 @@
 'use strict';
 
 const {
+  ArrayIsArray,
+  ArrayPrototypePush,
   FunctionPrototypeCall,
   ObjectSetPrototypeOf,
   ReflectApply,
+  Uint32Array,
 } = primordials;
 
 const {
@@ -11,6 +14,7 @@ const {
     ERR_CRYPTO_SIGN_KEY_REQUIRED,
     ERR_INVALID_ARG_TYPE,
     ERR_INVALID_ARG_VALUE,
+    ERR_OUT_OF_RANGE,
   },
 } = require('internal/errors');
 
@@ -22,6 +26,7 @@ const {
 
 const {
   Sign: _Sign,
+  SignBatchJob,
   SignJob,
   Verify: _Verify,
   kCryptoJobAsync,
@@ -35,6 +40,7 @@ const {
 const {
   getArrayBufferOrView,
   getDefaultEncoding,
+  packBatch,
   kHandle,
 } = require('internal/crypto/util');
 
@@ -299,9 +305,130 @@ function verifyOneShot(algorithm, data, key, signature, callback) {
   job.run();
 }
 
+const kEmptyBuffer = Buffer.alloc(0);
+
+function validateBatchKey(key) {
+  if (!key)
+    throw new ERR_CRYPTO_SIGN_KEY_REQUIRED();
+}
+
+function runSignBatch(mode, algorithm, data, key, signatures, callback,
+                      decode) {
+  if (algorithm != null)
+    validateString(algorithm, 'algorithm');
+  if (!ArrayIsArray(data))
+    throw new ERR_INVALID_ARG_TYPE('data', 'Array', data);
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+  validateBatchKey(key);
+
+  const { data: packed, offsets } = packBatch(data, 'data');
+
+  // Options specific to RSA
+  const rsaPadding = getPadding(key);
+  const pssSaltLength = getSaltLength(key);
+
+  // Options specific to (EC)DSA
+  const dsaSigEnc = getDSASignatureEncoding(key);
+
+  const {
+    data: keyData,
+    format: keyFormat,
+    type: keyType,
+    passphrase: keyPassphrase,
+  } = mode === kSignJobModeSign ?
+    preparePrivateKey(key) :
+    preparePublicOrPrivateKey(key);
+
+  const job = new SignBatchJob(
+    callback ? kCryptoJobAsync : kCryptoJobSync,
+    mode,
+    keyData,
+    keyFormat,
+    keyType,
+    keyPassphrase,
+    packed,
+    algorithm,
+    pssSaltLength,
+    rsaPadding,
+    dsaSigEnc,
+    signatures === undefined ? undefined : kEmptyBuffer,
+    offsets,
+    signatures?.data,
+    signatures?.offsets);
+
+  if (!callback) {
+    const { 0: err, 1: result } = job.run();
+    if (err !== undefined)
+      throw err;
+
+    return decode(result, data.length);
+  }
+
+  job.ondone = (error, result) => {
+    if (error) return FunctionPrototypeCall(callback, job, error);
+    FunctionPrototypeCall(callback, job, null, decode(result, data.length));
+  };
+  job.run();
+}
+
+// The result of a batch signing job starts with count + 1 offsets that delimit
+// the signatures which follow them.
+function decodeSignatures(result, count) {
+  const offsets = new Uint32Array(result, 0, count + 1);
+  const base = offsets.byteLength;
+  const buffer = Buffer.from(result);
+  const signatures = [];
+  for (let i = 0; i < count; i++) {
+    ArrayPrototypePush(
+      signatures,
+      buffer.subarray(base + offsets[i], base + offsets[i + 1]));
+  }
+  return signatures;
+}
+
+function decodeVerifyResults(result, count) {
+  const bytes = Buffer.from(result);
+  const results = [];
+  for (let i = 0; i < count; i++)
+    ArrayPrototypePush(results, bytes[i] === 1);
+  return results;
+}
+
+function signBatch(algorithm, data, key, callback) {
+  return runSignBatch(kSignJobModeSign, algorithm, data, key, undefined,
+                      callback, decodeSignatures);
+}
+
+function verifyBatch(algorithm, data, key, signatures, callback) {
+  if (!ArrayIsArray(data))
+    throw new ERR_INVALID_ARG_TYPE('data', 'Array', data);
+  if (!ArrayIsArray(signatures))
+    throw new ERR_INVALID_ARG_TYPE('signatures', 'Array', signatures);
+  if (signatures.length !== data.length) {
+    throw new ERR_OUT_OF_RANGE(
+      'signatures.length', `${data.length}`, signatures.length);
+  }
+  for (let i = 0; i < signatures.length; i++) {
+    if (!isArrayBufferView(signatures[i])) {
+      throw new ERR_INVALID_ARG_TYPE(
+        `signatures[${i}]`,
+        ['Buffer', 'TypedArray', 'DataView'],
+        signatures[i],
+      );
+    }
+  }
+  validateBatchKey(key);
+  return runSignBatch(kSignJobModeVerify, algorithm, data, key,
+                      packBatch(signatures, 'signatures'), callback,
+                      decodeVerifyResults);
+}
+
 module.exports = {
   Sign,
+  signBatch,
   signOneShot,
   Verify,
+  verifyBatch,
   verifyOneShot,
 };
@@ -19,7 +19,9 @@ const {
   TypedArrayPrototypeGetBuffer,
   TypedArrayPrototypeGetByteLength,
   TypedArrayPrototypeGetByteOffset,
+  TypedArrayPrototypeSet,
   TypedArrayPrototypeSlice,
+  Uint32Array,
   Uint8Array,
 } = primordials;
 
@@ -144,6 +146,42 @@ const getArrayBufferOrView = hideStackFrames((buffer, name, encoding) => {
 // The maximum buffer size that we'll support in the WebCrypto impl
 const kMaxBufferLength = (2 ** 31) - 1;
 
+// Packs an array of inputs into a single buffer for the batch APIs, and
+// returns it along with the offsets that delimit the individual inputs.
+function packBatch(inputs, name) {
+  const count = inputs.length;
+  const offsets = new Uint32Array(count + 1);
+  let total = 0;
+  for (let i = 0; i < count; i++) {
+    const input = inputs[i];
+    if (typeof input === 'string') {
+      total += Buffer.byteLength(input);
+    } else if (isArrayBufferView(input)) {
+      total += input.byteLength;
+    } else {
+      throw new ERR_INVALID_ARG_TYPE(
+        `${name}[${i}]`, ['Buffer', 'TypedArray', 'DataView', 'string'], input);
+    }
+    if (total > kMaxBufferLength)
+      throw new ERR_OUT_OF_RANGE(name, `<= ${kMaxBufferLength} bytes`, total);
+    offsets[i + 1] = total;
+  }
+
+  const data = Buffer.allocUnsafe(total);
+  for (let i = 0; i < count; i++) {
+    const input = inputs[i];
+    if (typeof input === 'string') {
+      data.utf8Write(input, offsets[i]);
+    } else {
+      TypedArrayPrototypeSet(
+        data,
+        new Uint8Array(input.buffer, input.byteOffset, input.byteLength),
+        offsets[i]);
+    }
+  }
+  return { data, offsets };
+}
+
 // The EC named curves that we currently support via the Web Crypto API.
 const kNamedCurveAliases = {
   'P-256': 'prime256v1',
@@ -585,5 +623,6 @@ module.exports = {
   getBlockSize,
   getStringOption,
   getUsagesUnion,
+  packBatch,
   secureHeapUsed,
 };
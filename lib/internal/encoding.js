@@ -32,6 +32,8 @@ const kEncoder = Symbol('encoder');
 const kFatal = Symbol('kFatal');
 const kUTF8FastPath = Symbol('kUTF8FastPath');
 const kIgnoreBOM = Symbol('kIgnoreBOM');
+const kBOMSeen = Symbol('BOM seen');
+const kPending = Symbol('pending');
 
 const {
   getConstructorOf,
@@ -55,6 +57,9 @@ const {
   encodeInto,
   encodeUtf8String,
   decodeUTF8,
+  decodeUTF8Stream,
+  decodeUTF16LEStream,
+  decodeWindows1252,
 } = internalBinding('buffer');
 
 let Buffer;
@@ -410,8 +415,14 @@ function makeTextDecoderICU() {
       // Only support fast path for UTF-8.
       this[kUTF8FastPath] = enc === 'utf-8';
       this[kHandle] = undefined;
+      this[kBOMSeen] = false;
+      // Incomplete characters at the end of streamed chunks, for the
+      // encodings that are decoded without ICU.
+      this[kPending] = undefined;
 
-      if (!this[kUTF8FastPath]) {
+      if (enc === 'utf-8' || enc === 'utf-16le') {
+        this[kPending] = new Uint8Array(4);
+      } else if (enc !== 'windows-1252') {
         this.#prepareConverter();
       }
     }
@@ -433,19 +444,42 @@ function makeTextDecoderICU() {
         return decodeUTF8(input, this[kIgnoreBOM], this[kFatal]);
       }
 
-      this.#prepareConverter();
-
       validateObject(options, 'options', {
         nullable: true,
         allowArray: true,
         allowFunction: true,
       });
 
-      let flags = 0;
-      if (options !== null)
-        flags |= options.stream ? 0 : CONVERTER_FLAGS_FLUSH;
+      const flush = !options?.stream;
+      let result;
+      switch (this[kEncoding]) {
+        case 'utf-8':
+          result = decodeUTF8Stream(input, this[kPending], this[kFatal], flush);
+          break;
+        case 'utf-16le':
+          result =
+            decodeUTF16LEStream(input, this[kPending], this[kFatal], flush);
+          break;
+        case 'windows-1252':
+          return decodeWindows1252(input);
+        default: {
+          this.#prepareConverter();
+          const flags = flush ? CONVERTER_FLAGS_FLUSH : 0;
+          return _decode(this[kHandle], input, flags, this.encoding);
+        }
+      }
 
-      return _decode(this[kHandle], input, flags, this.encoding);
+      if (result.length > 0 && !this[kBOMSeen] && !this[kIgnoreBOM]) {
+        // If the very first result in the stream is a BOM, and we are not
+        // explicitly told to ignore it, then we discard it.
+        if (result[0] === '\ufeff') {
+          result = StringPrototypeSlice(result, 1);
+        }
+        this[kBOMSeen] = true;
+      }
+      if (flush)
+        this[kBOMSeen] = false;
+      return result;
     }
   }
 
@@ -460,8 +494,6 @@ function makeTextDecoderJS() {
     return StringDecoder;
   }
 
-  const kBOMSeen = Symbol('BOM seen');
-
   function hasConverter(encoding) {
     return encoding === 'utf-8' || encoding === 'utf-16le';
   }
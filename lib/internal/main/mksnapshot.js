@@ -94,15 +94,23 @@ function supportedInUserSnapshot(id) {
   return supportedModules.has(id);
 }
 
+// Set by main() to the absolute path of the entry point.
+let entryFilename;
+let requireUserModule;
+
 function requireForUserSnapshot(id) {
   const normalizedId = normalizeRequirableId(id);
   if (!normalizedId) {
-    // eslint-disable-next-line no-restricted-syntax
-    const err = new Error(
-      `Cannot find module '${id}'. `,
-    );
-    err.code = 'MODULE_NOT_FOUND';
-    throw err;
+    // User-land CommonJS modules are resolved relative to the entry point and
+    // become part of the snapshot, along with the module cache. Requiring
+    // them again after deserialization returns the cached module without
+    // touching the file system.
+    if (requireUserModule === undefined) {
+      const { Module, initializeCJS } = require('internal/modules/cjs/loader');
+      initializeCJS();
+      requireUserModule = Module.createRequire(entryFilename);
+    }
+    return requireUserModule(id);
   }
   if (!supportedInUserSnapshot(normalizedId)) {
     if (!warnedModules.has(normalizedId)) {
@@ -126,6 +134,7 @@ function main() {
   const path = require('path');
   const filename = path.resolve(file);
   const dirname = path.dirname(filename);
+  entryFilename = filename;
   const source = readFileSync(file, 'utf-8');
   const serializeMainFunction = compileSerializeMain(filename, source);
 
@@ -145,6 +154,12 @@ function main() {
     }
   });
 
+  // Setting up the module loaders after deserialization asserts that no user
+  // module has run yet, which does not apply to the ones in the snapshot.
+  addSerializeCallback(() => {
+    require('internal/modules/cjs/loader').resetHasLoadedAnyUserCJSModule();
+  });
+
   if (getOptionValue('--inspect-brk')) {
     internalBinding('inspector').callAndPauseOnStart(
       serializeMainFunction, undefined,
@@ -71,6 +71,7 @@ module.exports = {
   wrapSafe, Module, cjsParseCache,
   get hasLoadedAnyUserCJSModule() { return hasLoadedAnyUserCJSModule; },
   initializeCJS,
+  resetHasLoadedAnyUserCJSModule,
 };
 
 const { BuiltinModule } = require('internal/bootstrap/realm');
@@ -121,6 +122,12 @@ const getCascadedLoader = getLazy(
 // Used for internal assertions.
 let hasLoadedAnyUserCJSModule = false;
 
+// Modules that are loaded while building a user-land snapshot are restored
+// with it, before the loaders are set up again after deserialization.
+function resetHasLoadedAnyUserCJSModule() {
+  hasLoadedAnyUserCJSModule = false;
+}
+
 const {
   codes: {
     ERR_INVALID_ARG_VALUE,
@@ -1284,7 +1291,7 @@ function wrapSafe(filename, content, cjsModuleInstance) {
         return cascadedLoader.import(specifier, normalizeReferrerURL(filename),
                                      importAttributes);
       },
-    });
+    }, true);
 
     // Cache the source map for the module if present.
     if (result.sourceMapURL) {
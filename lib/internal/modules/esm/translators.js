@@ -149,7 +149,10 @@ translators.set('module', async function moduleStrategy(url, source, isMain) {
   source = stringify(source);
   maybeCacheSourceMap(url, source);
   debug(`Translating StandardModule ${url}`);
-  const module = new ModuleWrap(url, undefined, source, 0, 0);
+  // Only modules loaded from files are kept in the compile cache.
+  const useCompileCache = StringPrototypeStartsWith(url, 'file:');
+  const module = new ModuleWrap(url, undefined, source, 0, 0, undefined,
+                                useCompileCache);
   const { setCallbackForWrap } = require('internal/modules/esm/utils');
   setCallbackForWrap(module, {
     initializeImportMeta: (meta, wrap) => this.importMetaInitialize(meta, { url }),
@@ -320,9 +320,44 @@ function hasEsmSyntax(code) {
     stmt.type === 'ExportAllDeclaration');
 }
 
+/**
+ * Returns the statistics of the compile cache enabled with NODE_COMPILE_CACHE.
+ * @returns {{ directory: string, hits: number, misses: number,
+ *   rejected: number, written: number } | undefined}
+ */
+function getCompileCacheStats() {
+  const { getCompileCacheStats } = internalBinding('contextify');
+  const stats = getCompileCacheStats();
+  if (stats === undefined) {
+    return undefined;
+  }
+  const { 0: directory, 1: hits, 2: misses, 3: rejected, 4: written } = stats;
+  return { directory, hits, misses, rejected, written };
+}
+
+/**
+ * Writes the code cache of the modules compiled so far to the compile cache
+ * directory, which otherwise only happens when the process exits.
+ */
+function flushCompileCache() {
+  internalBinding('contextify').flushCompileCache();
+}
+
+/**
+ * Writes the module resolution lookups done so far to the resolution cache
+ * file enabled with NODE_RESOLUTION_CACHE, which otherwise only happens when
+ * the process exits.
+ */
+function flushResolutionCache() {
+  internalBinding('fs').flushResolutionCache();
+}
+
 module.exports = {
   addBuiltinLibsToObject,
+  flushCompileCache,
+  flushResolutionCache,
   getCjsConditions,
+  getCompileCacheStats,
   initializeCjsConditions,
   hasEsmSyntax,
   loadBuiltinModule,
@@ -35,6 +35,62 @@ let manifest;
  * }} PackageConfig
  */
 
+/**
+ * @param {string} string
+ * @param {string} jsonPath
+ * @param {string | undefined} base
+ * @param {string} specifier
+ * @param {boolean} isESM
+ * @returns {unknown}
+ */
+function parseSource(string, jsonPath, base, specifier, isESM) {
+  try {
+    return JSONParse(string);
+  } catch (error) {
+    if (isESM) {
+      throw new ERR_INVALID_PACKAGE_CONFIG(
+        jsonPath,
+        (base ? `"${specifier}" from ` : '') + fileURLToPath(base || specifier),
+        error.message,
+      );
+    } else {
+      // For backward compat, we modify the error returned by JSON.parse rather than creating a new one.
+      // TODO(aduh95): make it throw ERR_INVALID_PACKAGE_CONFIG in a semver-major with original error as cause
+      error.message = 'Error parsing ' + jsonPath + ': ' + error.message;
+      error.path = jsonPath;
+      throw error;
+    }
+  }
+}
+
+/**
+ * @param {PackageConfig} result
+ * @param {any} parsed
+ */
+function extractFields(result, parsed) {
+  // ObjectPrototypeHasOwnProperty is used to avoid prototype pollution.
+  if (ObjectPrototypeHasOwnProperty(parsed, 'name') && typeof parsed.name === 'string') {
+    result.name = parsed.name;
+  }
+
+  if (ObjectPrototypeHasOwnProperty(parsed, 'main') && typeof parsed.main === 'string') {
+    result.main = parsed.main;
+  }
+
+  if (ObjectPrototypeHasOwnProperty(parsed, 'exports')) {
+    result.exports = parsed.exports;
+  }
+
+  if (ObjectPrototypeHasOwnProperty(parsed, 'imports')) {
+    result.imports = parsed.imports;
+  }
+
+  // Ignore unknown types for forwards compatibility
+  if (ObjectPrototypeHasOwnProperty(parsed, 'type') && (parsed.type === 'commonjs' || parsed.type === 'module')) {
+    result.type = parsed.type;
+  }
+}
+
 /**
  * @param {string} jsonPath
  * @param {{
@@ -49,12 +105,23 @@ function read(jsonPath, { base, specifier, isESM } = kEmptyObject) {
     return cache.get(jsonPath);
   }
 
+  if (manifest === undefined) {
+    const { getOptionValue } = require('internal/options');
+    manifest = getOptionValue('--experimental-policy') ?
+      require('internal/process/policy').manifest :
+      null;
+  }
+
+  // The fields used for resolution are extracted natively, and the whole
+  // source is only needed to check its integrity against the policy.
+  const pjson = internalModuleReadJSON(
+    toNamespacedPath(jsonPath),
+    manifest !== null,
+  );
   const {
     0: string,
     1: containsKeys,
-  } = internalModuleReadJSON(
-    toNamespacedPath(jsonPath),
-  );
+  } = pjson;
   const result = {
     __proto__: null,
     exists: false,
@@ -71,58 +138,37 @@ function read(jsonPath, { base, specifier, isESM } = kEmptyObject) {
   // https://github.com/nodejs/node/pull/48477#issuecomment-1604586650
   // TODO(anonrig): Follow-up on this change and remove it since it is a
   // semver-major change.
-  const isResultValid = isAIX && !isESM ? containsKeys : string !== undefined;
+  const isResultValid = isAIX && !isESM ? containsKeys : pjson.length > 0;
 
   if (isResultValid) {
-    let parsed;
-    try {
-      parsed = JSONParse(string);
-    } catch (error) {
-      if (isESM) {
-        throw new ERR_INVALID_PACKAGE_CONFIG(
-          jsonPath,
-          (base ? `"${specifier}" from ` : '') + fileURLToPath(base || specifier),
-          error.message,
-        );
-      } else {
-        // For backward compat, we modify the error returned by JSON.parse rather than creating a new one.
-        // TODO(aduh95): make it throw ERR_INVALID_PACKAGE_CONFIG in a semver-major with original error as cause
-        error.message = 'Error parsing ' + jsonPath + ': ' + error.message;
-        error.path = jsonPath;
-        throw error;
+    if (pjson.length === 2) {
+      // The source is not a JSON object that could be parsed natively.
+      extractFields(result, parseSource(string, jsonPath, base, specifier,
+                                        isESM));
+    } else {
+      const {
+        2: name,
+        3: main,
+        4: exports,
+        5: imports,
+        6: type,
+      } = pjson;
+      result.name = name;
+      result.main = main;
+      if (exports !== undefined) {
+        result.exports = JSONParse(exports);
+      }
+      if (imports !== undefined) {
+        result.imports = JSONParse(imports);
+      }
+      // Ignore unknown types for forwards compatibility
+      if (type === 'commonjs' || type === 'module') {
+        result.type = type;
       }
     }
 
     result.exists = true;
 
-    // ObjectPrototypeHasOwnProperty is used to avoid prototype pollution.
-    if (ObjectPrototypeHasOwnProperty(parsed, 'name') && typeof parsed.name === 'string') {
-      result.name = parsed.name;
-    }
-
-    if (ObjectPrototypeHasOwnProperty(parsed, 'main') && typeof parsed.main === 'string') {
-      result.main = parsed.main;
-    }
-
-    if (ObjectPrototypeHasOwnProperty(parsed, 'exports')) {
-      result.exports = parsed.exports;
-    }
-
-    if (ObjectPrototypeHasOwnProperty(parsed, 'imports')) {
-      result.imports = parsed.imports;
-    }
-
-    // Ignore unknown types for forwards compatibility
-    if (ObjectPrototypeHasOwnProperty(parsed, 'type') && (parsed.type === 'commonjs' || parsed.type === 'module')) {
-      result.type = parsed.type;
-    }
-
-    if (manifest === undefined) {
-      const { getOptionValue } = require('internal/options');
-      manifest = getOptionValue('--experimental-policy') ?
-        require('internal/process/policy').manifest :
-        null;
-    }
     if (manifest !== null) {
       const jsonURL = pathToFileURL(jsonPath);
       manifest.assertIntegrity(jsonURL, string);
@@ -26,6 +26,7 @@ const {
 } = require('internal/util/types');
 
 const {
+  validateBoolean,
   validateBuffer,
   validateInt32,
   validateObject,
@@ -138,8 +139,10 @@ function configSecureContext(context, options = kEmptyObject, name = 'options')
     pfx,
     privateKeyIdentifier,
     privateKeyEngine,
+    privateKeyOffload,
     sessionIdContext,
     sessionTimeout,
+    sharedSessionCache,
     sigalgs,
     ticketKeys,
   } = options;
@@ -292,6 +295,24 @@ function configSecureContext(context, options = kEmptyObject, name = 'options')
                                    clientCertEngine);
   }
 
+  if (privateKeyOffload !== undefined && privateKeyOffload !== null) {
+    validateBoolean(privateKeyOffload, `${name}.privateKeyOffload`);
+    if (privateKeyOffload)
+      context.enablePrivateKeyOffload();
+  }
+
+  // This also replaces the ticket keys of the context, so it has to happen
+  // before explicitly given ticketKeys are applied.
+  if (sharedSessionCache !== undefined && sharedSessionCache !== null &&
+      sharedSessionCache !== false) {
+    if (sharedSessionCache === true) {
+      context.enableSharedSessionCache('default');
+    } else {
+      validateString(sharedSessionCache, `${name}.sharedSessionCache`);
+      context.enableSharedSessionCache(sharedSessionCache);
+    }
+  }
+
   if (ticketKeys !== undefined && ticketKeys !== null) {
     validateBuffer(ticketKeys, `${name}.ticketKeys`);
     if (ticketKeys.byteLength !== 48) {
@@ -8,7 +8,6 @@ const {
   ArrayPrototypePush,
   ArrayPrototypeReduce,
   ArrayPrototypeSlice,
-  Int8Array,
   IteratorPrototype,
   Number,
   ObjectCreate,
@@ -41,8 +40,6 @@ const {
 const { inspect } = require('internal/util/inspect');
 const {
   encodeStr,
-  hexTable,
-  isHexTable,
 } = require('internal/querystring');
 
 const {
@@ -69,14 +66,10 @@ const {
   },
 } = require('internal/errors');
 const {
-  CHAR_AMPERSAND,
   CHAR_BACKWARD_SLASH,
-  CHAR_EQUAL,
   CHAR_FORWARD_SLASH,
   CHAR_LOWERCASE_A,
   CHAR_LOWERCASE_Z,
-  CHAR_PERCENT,
-  CHAR_PLUS,
 } = require('internal/constants');
 const path = require('path');
 
@@ -84,8 +77,6 @@ const {
   validateFunction,
 } = require('internal/validators');
 
-const querystring = require('querystring');
-
 const { platform } = process;
 const isWindows = platform === 'win32';
 
@@ -1078,140 +1069,15 @@ ObjectDefineProperties(URL, {
 // application/x-www-form-urlencoded parser
 // Ref: https://url.spec.whatwg.org/#concept-urlencoded-parser
 function parseParams(qs) {
-  const out = [];
-  let seenSep = false;
-  let buf = '';
-  let encoded = false;
-  let encodeCheck = 0;
-  let i = qs[0] === '?' ? 1 : 0;
-  let pairStart = i;
-  let lastPos = i;
-  for (; i < qs.length; ++i) {
-    const code = StringPrototypeCharCodeAt(qs, i);
-
-    // Try matching key/value pair separator
-    if (code === CHAR_AMPERSAND) {
-      if (pairStart === i) {
-        // We saw an empty substring between pair separators
-        lastPos = pairStart = i + 1;
-        continue;
-      }
-
-      if (lastPos < i)
-        buf += qs.slice(lastPos, i);
-      if (encoded)
-        buf = querystring.unescape(buf);
-      out.push(buf);
-
-      // If `buf` is the key, add an empty value.
-      if (!seenSep)
-        out.push('');
-
-      seenSep = false;
-      buf = '';
-      encoded = false;
-      encodeCheck = 0;
-      lastPos = pairStart = i + 1;
-      continue;
-    }
-
-    // Try matching key/value separator (e.g. '=') if we haven't already
-    if (!seenSep && code === CHAR_EQUAL) {
-      // Key/value separator match!
-      if (lastPos < i)
-        buf += qs.slice(lastPos, i);
-      if (encoded)
-        buf = querystring.unescape(buf);
-      out.push(buf);
-
-      seenSep = true;
-      buf = '';
-      encoded = false;
-      encodeCheck = 0;
-      lastPos = i + 1;
-      continue;
-    }
-
-    // Handle + and percent decoding.
-    if (code === CHAR_PLUS) {
-      if (lastPos < i)
-        buf += StringPrototypeSlice(qs, lastPos, i);
-      buf += ' ';
-      lastPos = i + 1;
-    } else if (!encoded) {
-      // Try to match an (valid) encoded byte (once) to minimize unnecessary
-      // calls to string decoding functions
-      if (code === CHAR_PERCENT) {
-        encodeCheck = 1;
-      } else if (encodeCheck > 0) {
-        if (isHexTable[code] === 1) {
-          if (++encodeCheck === 3) {
-            encoded = true;
-          }
-        } else {
-          encodeCheck = 0;
-        }
-      }
-    }
-  }
-
-  // Deal with any leftover key or value data
-
-  // There is a trailing &. No more processing is needed.
-  if (pairStart === i)
-    return out;
-
-  if (lastPos < i)
-    buf += StringPrototypeSlice(qs, lastPos, i);
-  if (encoded)
-    buf = querystring.unescape(buf);
-  ArrayPrototypePush(out, buf);
-
-  // If `buf` is the key, add an empty value.
-  if (!seenSep)
-    ArrayPrototypePush(out, '');
-
-  return out;
+  return bindingUrl.parseSearchParams(qs);
 }
 
-// Adapted from querystring's implementation.
-// Ref: https://url.spec.whatwg.org/#concept-urlencoded-byte-serializer
-const noEscape = new Int8Array([
-/*
-  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, A, B, C, D, E, F
-*/
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x00 - 0x0F
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x10 - 0x1F
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, // 0x20 - 0x2F
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, // 0x30 - 0x3F
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x40 - 0x4F
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, // 0x50 - 0x5F
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x60 - 0x6F
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,  // 0x70 - 0x7F
-]);
-
-// Special version of hexTable that uses `+` for U+0020 SPACE.
-const paramHexTable = hexTable.slice();
-paramHexTable[0x20] = '+';
-
 // application/x-www-form-urlencoded serializer
 // Ref: https://url.spec.whatwg.org/#concept-urlencoded-serializer
 function serializeParams(array) {
-  const len = array.length;
-  if (len === 0)
+  if (array.length === 0)
     return '';
-
-  const firstEncodedParam = encodeStr(array[0], noEscape, paramHexTable);
-  const firstEncodedValue = encodeStr(array[1], noEscape, paramHexTable);
-  let output = `${firstEncodedParam}=${firstEncodedValue}`;
-
-  for (let i = 2; i < len; i += 2) {
-    const encodedParam = encodeStr(array[i], noEscape, paramHexTable);
-    const encodedValue = encodeStr(array[i + 1], noEscape, paramHexTable);
-    output += `&${encodedParam}=${encodedValue}`;
-  }
-
-  return output;
+  return bindingUrl.serializeSearchParams(array);
 }
 
 // Mainly to mitigate func-name-matching ESLint rule
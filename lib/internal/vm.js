@@ -28,7 +28,17 @@ function isContext(object) {
   return _isContext(object);
 }
 
-function internalCompileFunction(code, params, options) {
+/**
+ * Compiles a function with the given parameters.
+ * @param {string} code
+ * @param {string[]} [params]
+ * @param {object} options See `vm.compileFunction()`.
+ * @param {boolean} [useCompileCache] Whether to consult the on-disk compile
+ *   cache enabled with NODE_COMPILE_CACHE. Used for user CommonJS modules.
+ * @returns {object}
+ */
+function internalCompileFunction(code, params, options,
+                                 useCompileCache = false) {
   validateString(code, 'code');
   if (params !== undefined) {
     validateStringArray(params, 'params');
@@ -80,6 +90,7 @@ function internalCompileFunction(code, params, options) {
     parsingContext,
     contextExtensions,
     params,
+    useCompileCache,
   );
 
   if (produceCachedData) {
@@ -50,7 +50,7 @@ function isDecompressionStream(value) {
 
 class CompressionStream {
   /**
-   * @param {'deflate'|'gzip'} format
+   * @param {'deflate'|'gzip'|'zstd'} format
    */
   constructor(format) {
     this[kType] = 'CompressionStream';
@@ -61,6 +61,9 @@ class CompressionStream {
       case 'gzip':
         this[kHandle] = lazyZlib().createGzip();
         break;
+      case 'zstd':
+        this[kHandle] = lazyZlib().createZstdCompress();
+        break;
       default:
         throw new ERR_INVALID_ARG_VALUE('format', format);
     }
@@ -99,7 +102,7 @@ class CompressionStream {
 
 class DecompressionStream {
   /**
-   * @param {'deflate'|'gzip'} format
+   * @param {'deflate'|'gzip'|'zstd'} format
    */
   constructor(format) {
     this[kType] = 'DecompressionStream';
@@ -110,6 +113,9 @@ class DecompressionStream {
       case 'gzip':
         this[kHandle] = lazyZlib().createGunzip();
         break;
+      case 'zstd':
+        this[kHandle] = lazyZlib().createZstdDecompress();
+        break;
       default:
         throw new ERR_INVALID_ARG_VALUE('format', format);
     }
@@ -0,0 +1,127 @@
+'use strict';
+
+const {
+  ObjectSetPrototypeOf,
+  Symbol,
+} = primordials;
+
+const {
+  Dictionary: DictionaryHandle,
+} = internalBinding('zlib');
+
+const {
+  customInspectSymbol: kInspect,
+} = require('internal/util');
+
+const {
+  isAnyArrayBuffer,
+  isArrayBufferView,
+} = require('internal/util/types');
+
+const {
+  JSTransferable,
+  kClone,
+  kDeserialize,
+} = require('internal/worker/js_transferable');
+
+const {
+  codes: {
+    ERR_INVALID_ARG_TYPE,
+  },
+} = require('internal/errors');
+
+const { inspect } = require('internal/util/inspect');
+const { Buffer } = require('buffer');
+
+const kHandle = Symbol('kHandle');
+// Identifies the dictionary for the purpose of pooling zlib handles that have
+// it preloaded. Clones received from other threads get their own serial.
+const kSerial = Symbol('kSerial');
+const { owner_symbol } = internalBinding('symbols');
+
+let nextSerial = 0;
+
+function setHandle(dictionary, handle) {
+  dictionary[kHandle] = handle;
+  dictionary[kSerial] = ++nextSerial;
+  handle[owner_symbol] = dictionary;
+}
+
+class Dictionary extends JSTransferable {
+  constructor(data) {
+    super();
+    if (typeof data === 'string' || isAnyArrayBuffer(data)) {
+      data = Buffer.from(data);
+    } else if (!isArrayBufferView(data)) {
+      throw new ERR_INVALID_ARG_TYPE(
+        'data',
+        ['string', 'Buffer', 'TypedArray', 'DataView', 'ArrayBuffer'],
+        data,
+      );
+    }
+    setHandle(this, new DictionaryHandle(data));
+  }
+
+  /**
+   * The Adler-32 checksum of the dictionary, as stored in the header of
+   * zlib streams that were compressed with it.
+   * @type {number}
+   */
+  get id() {
+    return this[kHandle].id;
+  }
+
+  /**
+   * @type {number}
+   */
+  get size() {
+    return this[kHandle].size;
+  }
+
+  [kInspect](depth, options) {
+    if (depth < 0)
+      return this;
+
+    const opts = {
+      ...options,
+      depth: options.depth == null ? null : options.depth - 1,
+    };
+
+    return `Dictionary ${inspect({ id: this.id, size: this.size }, opts)}`;
+  }
+
+  [kClone]() {
+    const handle = this[kHandle];
+    return {
+      data: { handle },
+      deserializeInfo: 'internal/zlib_dictionary:InternalDictionary',
+    };
+  }
+
+  [kDeserialize]({ handle }) {
+    setHandle(this, handle);
+  }
+}
+
+class InternalDictionary extends JSTransferable {
+  constructor(handle) {
+    super();
+    if (handle !== undefined)
+      setHandle(this, handle);
+  }
+}
+
+InternalDictionary.prototype.constructor = Dictionary.prototype.constructor;
+ObjectSetPrototypeOf(InternalDictionary.prototype, Dictionary.prototype);
+
+function isDictionary(value) {
+  return value?.[kHandle] instanceof DictionaryHandle;
+}
+
+module.exports = {
+  Dictionary,
+  InternalDictionary,
+  isDictionary,
+  kHandle,
+  kSerial,
+};
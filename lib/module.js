@@ -4,8 +4,16 @@ const { findSourceMap } = require('internal/source_map/source_map_cache');
 const { Module } = require('internal/modules/cjs/loader');
 const { register } = require('internal/modules/esm/loader');
 const { SourceMap } = require('internal/source_map/source_map');
+const {
+  flushCompileCache,
+  flushResolutionCache,
+  getCompileCacheStats,
+} = require('internal/modules/helpers');
 
 Module.findSourceMap = findSourceMap;
+Module.flushCompileCache = flushCompileCache;
+Module.flushResolutionCache = flushResolutionCache;
+Module.getCompileCacheStats = getCompileCacheStats;
 Module.register = register;
 Module.SourceMap = SourceMap;
 module.exports = Module;
@@ -60,7 +60,12 @@ const {
 
 const net = require('net');
 const { getOptionValue } = require('internal/options');
-const { getRootCertificates, getSSLCiphers } = internalBinding('crypto');
+const {
+  getRootCertificates,
+  getSSLCiphers,
+  getSharedSessionCacheStats: _getSharedSessionCacheStats,
+} = internalBinding('crypto');
+const { validateString } = require('internal/validators');
 const { Buffer } = require('buffer');
 const { canonicalizeIP } = internalBinding('cares_wrap');
 const _tls_common = require('_tls_common');
@@ -118,6 +123,19 @@ ObjectDefineProperty(exports, 'rootCertificates', {
   },
 });
 
+exports.getSharedSessionCacheStats = function getSharedSessionCacheStats(
+  name = 'default') {
+  validateString(name, 'name');
+  const stats = _getSharedSessionCacheStats(name);
+  if (stats === undefined)
+    return undefined;
+  return {
+    entries: stats[0],
+    hits: stats[1],
+    misses: stats[2],
+  };
+};
+
 // Convert protocols array into valid OpenSSL protocols list
 // ("\x06spdy/2\x08http/1.1\x08http/1.0")
 function convertProtocols(protocols) {
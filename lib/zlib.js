@@ -26,9 +26,12 @@ const {
   ArrayPrototypeForEach,
   ArrayPrototypeMap,
   ArrayPrototypePush,
+  ArrayPrototypeShift,
   FunctionPrototypeBind,
+  Int32Array,
   MathMaxApply,
   NumberIsFinite,
+  NumberIsInteger,
   NumberIsNaN,
   ObjectDefineProperties,
   ObjectDefineProperty,
@@ -36,6 +39,8 @@ const {
   ObjectKeys,
   ObjectSetPrototypeOf,
   ReflectApply,
+  SafeMap,
+  SafeSet,
   StringPrototypeStartsWith,
   Symbol,
   TypedArrayPrototypeFill,
@@ -48,7 +53,9 @@ const {
     ERR_BUFFER_TOO_LARGE,
     ERR_INVALID_ARG_TYPE,
     ERR_OUT_OF_RANGE,
+    ERR_NO_ZSTD,
     ERR_ZLIB_INITIALIZATION_FAILED,
+    ERR_ZSTD_INVALID_PARAM,
   },
   genericNodeError,
   hideStackFrames,
@@ -69,13 +76,23 @@ const {
   kMaxLength,
 } = require('buffer');
 const { owner_symbol } = require('internal/async_hooks').symbols;
+const {
+  Dictionary,
+  isDictionary,
+  kHandle: kDictionaryHandle,
+  kSerial: kDictionarySerial,
+} = require('internal/zlib_dictionary');
 const {
   validateFunction,
+  validateInteger,
   validateNumber,
+  validateUint32,
 } = require('internal/validators');
 
 const kFlushFlag = Symbol('kFlushFlag');
 const kError = Symbol('kError');
+const kParallel = Symbol('kParallel');
+const kPoolKey = Symbol('kPoolKey');
 
 const constants = internalBinding('constants').zlib;
 const {
@@ -91,6 +108,10 @@ const {
   // Brotli operations (~flush levels)
   BROTLI_OPERATION_PROCESS, BROTLI_OPERATION_FLUSH,
   BROTLI_OPERATION_FINISH, BROTLI_OPERATION_EMIT_METADATA,
+  ZSTD_COMPRESS, ZSTD_DECOMPRESS,
+  // Zstd end directives (~flush levels). Only present when Node.js is built
+  // with zstd support.
+  ZSTD_e_continue, ZSTD_e_flush, ZSTD_e_end,
 } = constants;
 
 // Translation table for return codes.
@@ -237,9 +258,11 @@ const checkRangesOrGetDefault = hideStackFrames(
 const FLUSH_BOUND = [
   [ Z_NO_FLUSH, Z_BLOCK ],
   [ BROTLI_OPERATION_PROCESS, BROTLI_OPERATION_EMIT_METADATA ],
+  [ ZSTD_e_continue, ZSTD_e_end ],
 ];
 const FLUSH_BOUND_IDX_NORMAL = 0;
 const FLUSH_BOUND_IDX_BROTLI = 1;
+const FLUSH_BOUND_IDX_ZSTD = 2;
 
 // The base class for all Zlib-style streams.
 function ZlibBase(opts, mode, handle, { flush, finishFlush, fullFlush }) {
@@ -248,10 +271,12 @@ function ZlibBase(opts, mode, handle, { flush, finishFlush, fullFlush }) {
   // The ZlibBase class is not exported to user land, the mode should only be
   // passed in by us.
   assert(typeof mode === 'number');
-  assert(mode >= DEFLATE && mode <= BROTLI_ENCODE);
+  assert(mode >= DEFLATE && mode <= ZSTD_DECOMPRESS);
 
   let flushBoundIdx;
-  if (mode !== BROTLI_ENCODE && mode !== BROTLI_DECODE) {
+  if (mode === ZSTD_COMPRESS || mode === ZSTD_DECOMPRESS) {
+    flushBoundIdx = FLUSH_BOUND_IDX_ZSTD;
+  } else if (mode !== BROTLI_ENCODE && mode !== BROTLI_DECODE) {
     flushBoundIdx = FLUSH_BOUND_IDX_NORMAL;
   } else {
     flushBoundIdx = FLUSH_BOUND_IDX_BROTLI;
@@ -337,6 +362,8 @@ ObjectDefineProperty(ZlibBase.prototype, 'bytesRead', {
 ZlibBase.prototype.reset = function() {
   if (!this._handle)
     assert(false, 'zlib binding closed');
+  if (this[kParallel] !== undefined)
+    this[kParallel].reset();
   return this._handle.reset();
 };
 
@@ -421,7 +448,10 @@ ZlibBase.prototype._transform = function(chunk, encoding, cb) {
   if (this.writableEnded && this.writableLength === chunk.byteLength) {
     flushFlag = maxFlush(flushFlag, this._finishFlushFlag);
   }
-  processChunk(this, chunk, flushFlag, cb);
+  if (this[kParallel] !== undefined)
+    this[kParallel].transform(chunk, flushFlag, cb);
+  else
+    processChunk(this, chunk, flushFlag, cb);
 };
 
 ZlibBase.prototype._processChunk = function(chunk, flushFlag, cb) {
@@ -511,7 +541,7 @@ function processChunkSync(self, chunk, flushFlag) {
   }
 
   self.bytesWritten = inputRead;
-  _close(self);
+  releaseHandle(self);
 
   if (nread === 0)
     return Buffer.alloc(0);
@@ -639,6 +669,33 @@ function _close(engine) {
   engine._handle = null;
 }
 
+// The one-shot *Sync() methods can reuse native zlib contexts: rather than
+// running deflateInit2()/inflateInit2() and freeing the state on every call,
+// a finished handle is reset (deflateReset()/inflateReset()) and kept for the
+// next call with identical parameters. At most kMaxPooledHandles contexts are
+// retained, keyed by mode and parameters; the oldest one is evicted first.
+const kMaxPooledHandles = 4;
+const pooledHandles = new SafeMap();
+let usePooledHandle = false;
+
+function releaseHandle(engine) {
+  const key = engine[kPoolKey];
+  const handle = engine._handle;
+  if (key === undefined || !handle || pooledHandles.has(key)) {
+    _close(engine);
+    return;
+  }
+  engine._handle = null;
+  handle[owner_symbol] = null;
+  handle.reset();
+  if (pooledHandles.size >= kMaxPooledHandles) {
+    const { 0: oldest, 1: entry } = pooledHandles.entries().next().value;
+    pooledHandles.delete(oldest);
+    entry.handle.close();
+  }
+  pooledHandles.set(key, { handle, writeState: engine._writeState });
+}
+
 const zlibDefaultOpts = {
   flush: Z_NO_FLUSH,
   finishFlush: Z_FINISH,
@@ -647,11 +704,15 @@ const zlibDefaultOpts = {
 // Base class for all streams actually backed by zlib and using zlib-specific
 // parameters.
 function Zlib(opts, mode) {
+  // Only set for the duration of a syncBufferWrapper() constructor call.
+  const poolable = usePooledHandle;
+  usePooledHandle = false;
   let windowBits = Z_DEFAULT_WINDOWBITS;
   let level = Z_DEFAULT_COMPRESSION;
   let memLevel = Z_DEFAULT_MEMLEVEL;
   let strategy = Z_DEFAULT_STRATEGY;
   let dictionary;
+  let dictionarySerial;
 
   if (opts) {
     // windowBits is special. On the compression side, 0 is an invalid value.
@@ -686,6 +747,9 @@ function Zlib(opts, mode) {
     if (dictionary !== undefined && !isArrayBufferView(dictionary)) {
       if (isAnyArrayBuffer(dictionary)) {
         dictionary = Buffer.from(dictionary);
+      } else if (isDictionary(dictionary)) {
+        dictionarySerial = dictionary[kDictionarySerial];
+        dictionary = dictionary[kDictionaryHandle];
       } else {
         throw new ERR_INVALID_ARG_TYPE(
           'options.dictionary',
@@ -696,23 +760,44 @@ function Zlib(opts, mode) {
     }
   }
 
-  const handle = new binding.Zlib(mode);
-  // Ideally, we could let ZlibBase() set up _writeState. I haven't been able
-  // to come up with a good solution that doesn't break our internal API,
-  // and with it all supported npm versions at the time of writing.
-  this._writeState = new Uint32Array(2);
-  handle.init(windowBits,
-              level,
-              memLevel,
-              strategy,
-              this._writeState,
-              processCallback,
-              dictionary);
+  // Raw dictionary buffers may be modified by the caller between calls, and
+  // UNZIP handles change their mode once the input format is detected, so
+  // neither can be pooled.
+  let poolKey;
+  if (poolable && mode !== UNZIP &&
+      (dictionary === undefined || dictionarySerial !== undefined)) {
+    poolKey = `${mode},${windowBits},${level},${memLevel},${strategy},` +
+              `${dictionarySerial}`;
+  }
+
+  let handle;
+  const pooled = poolKey !== undefined ? pooledHandles.get(poolKey) : undefined;
+  if (pooled !== undefined) {
+    pooledHandles.delete(poolKey);
+    handle = pooled.handle;
+    this._writeState = pooled.writeState;
+  } else {
+    handle = new binding.Zlib(mode);
+    // Ideally, we could let ZlibBase() set up _writeState. I haven't been able
+    // to come up with a good solution that doesn't break our internal API,
+    // and with it all supported npm versions at the time of writing.
+    this._writeState = new Uint32Array(2);
+    handle.init(windowBits,
+                level,
+                memLevel,
+                strategy,
+                this._writeState,
+                processCallback,
+                dictionary);
+  }
+  this[kPoolKey] = poolKey;
 
   ReflectApply(ZlibBase, this, [opts, mode, handle, zlibDefaultOpts]);
 
   this._level = level;
   this._strategy = strategy;
+  this._windowBits = windowBits;
+  this._memLevel = memLevel;
 }
 ObjectSetPrototypeOf(Zlib.prototype, ZlibBase.prototype);
 ObjectSetPrototypeOf(Zlib, ZlibBase);
@@ -744,6 +829,269 @@ Zlib.prototype.params = function params(level, strategy, callback) {
   }
 };
 
+// Parallel gzip compression, in the style of pigz.
+//
+// The input is split into blocks of kParallelBlockSize bytes, each of which is
+// compressed as raw deflate data on its own zlib handle, and therefore as its
+// own threadpool task. Every block is primed with the window of input that
+// precedes it so the compression ratio stays close to that of a sequential
+// stream. All but the last block end with a sync flush, which byte-aligns
+// their output so that the blocks can be concatenated, in order, into a
+// single deflate stream. The gzip header and trailer are written here.
+const kParallelBlockSize = 128 * 1024;
+const kMaxParallel = 1024;
+const kGzipOSCode = 3;  // Unix, matching what zlib writes on POSIX systems.
+
+function gzipHeader(level, strategy) {
+  // Mirror the "extra flags" byte that deflate() writes for these settings.
+  let xfl = 0;
+  if (level === Z_MAX_LEVEL)
+    xfl = 2;
+  else if ((level >= 0 && level < 2) || strategy >= constants.Z_HUFFMAN_ONLY)
+    xfl = 4;
+  return Buffer.from([0x1f, 0x8b, 8, 0, 0, 0, 0, 0, xfl, kGzipOSCode]);
+}
+
+function onParallelBlockError(message, errno, code) {
+  // `this` is the zlib handle of the block that failed.
+  const state = this.state;
+  this.close();
+  state.inFlight--;
+  const error = genericNodeError(message, { errno, code });
+  error.errno = errno;
+  error.code = code;
+  state.stream.destroy(error);
+  state.stream[kError] = error;
+}
+
+function onParallelBlockWrite() {
+  // `this` is the zlib handle of the block that was written.
+  const handle = this;
+  const state = handle.state;
+  const availOutAfter = handle.writeState[0];
+  const availInAfter = handle.writeState[1];
+
+  if (state.stream.destroyed) {
+    handle.close();
+    state.inFlight--;
+    return;
+  }
+  if (handle.generation !== state.generation) {
+    // The stream was reset while this block was being compressed.
+    handle.close();
+    state.inFlight--;
+    state.pump();
+    return;
+  }
+
+  const have = handle.out.byteLength - availOutAfter;
+  if (have > 0) {
+    ArrayPrototypePush(handle.chunks, handle.out.subarray(0, have));
+    handle.outLength += have;
+  }
+
+  if (availOutAfter === 0) {
+    // The output buffer was exhausted; keep going with what is left.
+    const inOff = handle.block.byteLength - availInAfter;
+    handle.out = Buffer.allocUnsafe(state.stream._chunkSize);
+    handle.write(handle.flushFlag,
+                 handle.block, // in
+                 inOff, // in_off
+                 availInAfter, // in_len
+                 handle.out, // out
+                 0, // out_off
+                 handle.out.byteLength); // out_len
+    return;
+  }
+
+  handle.close();
+  const chunks = handle.chunks;
+  state.blockDone(handle.seq, chunks.length === 1 ?
+    chunks[0] : Buffer.concat(chunks, handle.outLength));
+}
+
+class ParallelGzipState {
+  constructor(stream, parallel) {
+    this.stream = stream;
+    this.parallel = parallel;
+    this.windowSize = 1 << stream._windowBits;
+    // Input that has been written but not yet handed to a block.
+    this.pending = [];
+    this.pendingLength = 0;
+    // The tail of the input preceding the next block, used as its dictionary.
+    this.window = undefined;
+    this.crc = 0;
+    this.size = 0;
+    // Blocks are numbered in input order so that their output, which may
+    // complete out of order, can be pushed in order.
+    this.nextSeq = 0;
+    this.nextPush = 0;
+    this.results = new SafeMap();
+    // Incremented by reset(), so that the output of blocks that were
+    // dispatched before can be dropped.
+    this.generation = 0;
+    this.inFlight = 0;
+    this.flushFlag = Z_NO_FLUSH;
+    this.callback = null;
+    this.finished = false;
+    this.ended = false;
+  }
+
+  reset() {
+    // Blocks that are still in flight keep counting towards `inFlight` until
+    // they complete, so that no more than `parallel` are ever running.
+    this.generation++;
+    this.pending = [];
+    this.pendingLength = 0;
+    this.window = undefined;
+    this.crc = 0;
+    this.size = 0;
+    this.nextSeq = 0;
+    this.nextPush = 0;
+    this.results = new SafeMap();
+    this.finished = false;
+    this.ended = false;
+  }
+
+  transform(chunk, flushFlag, cb) {
+    if (this.finished) {
+      process.nextTick(cb);
+      return;
+    }
+    if (chunk.byteLength > 0) {
+      ArrayPrototypePush(this.pending, chunk);
+      this.pendingLength += chunk.byteLength;
+      this.stream.bytesWritten += chunk.byteLength;
+    }
+    this.flushFlag = flushFlag;
+    this.callback = cb;
+    this.pump();
+  }
+
+  pump() {
+    while (this.inFlight < this.parallel && !this.finished) {
+      if (this.pendingLength >= kParallelBlockSize) {
+        this.dispatch(kParallelBlockSize, Z_SYNC_FLUSH);
+      } else if (this.flushFlag === Z_FINISH) {
+        this.finished = true;
+        this.dispatch(this.pendingLength, Z_FINISH);
+      } else if (this.flushFlag !== Z_NO_FLUSH && this.pendingLength > 0) {
+        this.dispatch(this.pendingLength, Z_SYNC_FLUSH);
+        // A full flush resets the compression state, so the next block must
+        // not refer back to anything written before it.
+        if (this.flushFlag === Z_FULL_FLUSH)
+          this.window = undefined;
+      } else {
+        break;
+      }
+    }
+
+    const cb = this.callback;
+    if (cb === null)
+      return;
+    if (this.flushFlag === Z_NO_FLUSH) {
+      // Accept more input once every complete block has been dispatched.
+      if (this.pendingLength >= kParallelBlockSize)
+        return;
+    } else if (this.pendingLength > 0 || this.inFlight > 0 ||
+               (this.flushFlag === Z_FINISH && !this.ended)) {
+      // Flushes complete once all of the output has been pushed.
+      return;
+    }
+    this.callback = null;
+    cb();
+  }
+
+  takeInput(length) {
+    // The input is always copied so that the caller may reuse its buffers
+    // as soon as the write callback has been invoked.
+    const parts = [];
+    let remaining = length;
+    while (remaining > 0) {
+      const chunk = this.pending[0];
+      if (chunk.byteLength > remaining) {
+        ArrayPrototypePush(parts, chunk.subarray(0, remaining));
+        this.pending[0] = chunk.subarray(remaining);
+        remaining = 0;
+      } else {
+        ArrayPrototypePush(parts, chunk);
+        ArrayPrototypeShift(this.pending);
+        remaining -= chunk.byteLength;
+      }
+    }
+    this.pendingLength -= length;
+    return Buffer.concat(parts, length);
+  }
+
+  dispatch(length, flushFlag) {
+    const stream = this.stream;
+    const block = this.takeInput(length);
+    const dictionary = this.window;
+    this.crc = binding.crc32(block, this.crc);
+    this.size = (this.size + length) >>> 0;
+    if (length >= this.windowSize) {
+      this.window = block.subarray(length - this.windowSize);
+    } else if (length > 0) {
+      const window = dictionary === undefined ?
+        block : Buffer.concat([dictionary, block]);
+      this.window = window.subarray(
+        window.byteLength > this.windowSize ?
+          window.byteLength - this.windowSize : 0);
+    }
+
+    const handle = new binding.Zlib(DEFLATERAW);
+    handle.state = this;
+    handle.seq = this.nextSeq++;
+    handle.generation = this.generation;
+    handle.block = block;
+    handle.flushFlag = flushFlag;
+    handle.chunks = [];
+    handle.outLength = 0;
+    handle.writeState = new Uint32Array(2);
+    handle.onerror = onParallelBlockError;
+    handle.init(stream._windowBits,
+                stream._level,
+                stream._memLevel,
+                stream._strategy,
+                handle.writeState,
+                onParallelBlockWrite,
+                dictionary);
+    // Large enough for the compressed block in nearly all cases, see
+    // deflateBound(). The sync flush adds at most another 5 bytes.
+    handle.out = Buffer.allocUnsafe(
+      length + (length >>> 12) + (length >>> 14) + 64);
+    this.inFlight++;
+    handle.write(flushFlag,
+                 block, // in
+                 0, // in_off
+                 length, // in_len
+                 handle.out, // out
+                 0, // out_off
+                 handle.out.byteLength); // out_len
+  }
+
+  blockDone(seq, output) {
+    const stream = this.stream;
+    this.inFlight--;
+    this.results.set(seq, output);
+    while (this.results.has(this.nextPush)) {
+      if (this.nextPush === 0)
+        stream.push(gzipHeader(stream._level, stream._strategy));
+      stream.push(this.results.get(this.nextPush));
+      this.results.delete(this.nextPush);
+      this.nextPush++;
+    }
+    if (this.finished && this.inFlight === 0 && !this.ended) {
+      this.ended = true;
+      const trailer = Buffer.allocUnsafe(8);
+      trailer.writeUInt32LE(this.crc >>> 0, 0);
+      trailer.writeUInt32LE(this.size, 4);
+      stream.push(trailer);
+    }
+    this.pump();
+  }
+}
+
 // generic zlib
 // minimal 2-byte header
 function Deflate(opts) {
@@ -765,7 +1113,15 @@ ObjectSetPrototypeOf(Inflate, Zlib);
 function Gzip(opts) {
   if (!(this instanceof Gzip))
     return new Gzip(opts);
+  // The native handle is still created for parallel streams: the *Sync()
+  // methods and _processChunk() compress sequentially with it, and it backs
+  // close(), params() and the `_closed` state of the stream.
   ReflectApply(Zlib, this, [opts, GZIP]);
+  if (opts?.parallel !== undefined) {
+    validateInteger(opts.parallel, 'options.parallel', 1, kMaxParallel);
+    if (opts.parallel > 1)
+      this[kParallel] = new ParallelGzipState(this, opts.parallel);
+  }
 }
 ObjectSetPrototypeOf(Gzip.prototype, Zlib.prototype);
 ObjectSetPrototypeOf(Gzip, Zlib);
@@ -806,7 +1162,14 @@ ObjectSetPrototypeOf(Unzip, Zlib);
 function createConvenienceMethod(ctor, sync) {
   if (sync) {
     return function syncBufferWrapper(buffer, opts) {
-      return zlibBufferSync(new ctor(opts), buffer);
+      usePooledHandle = true;
+      let engine;
+      try {
+        engine = new ctor(opts);
+      } finally {
+        usePooledHandle = false;
+      }
+      return zlibBufferSync(engine, buffer);
     };
   }
   return function asyncBufferWrapper(buffer, opts, callback) {
@@ -825,6 +1188,16 @@ const kMaxBrotliParam = MathMaxApply(ArrayPrototypeMap(
     0),
 ));
 
+// Zstd parameters are sparse (e.g. ZSTD_d_windowLogMax is 100), so they are
+// passed to the binding as (key, value) pairs rather than a dense array.
+const kMaxZstdParam = MathMaxApply(ArrayPrototypeMap(
+  ObjectKeys(constants),
+  (key) => (StringPrototypeStartsWith(key, 'ZSTD_c_') ||
+            StringPrototypeStartsWith(key, 'ZSTD_d_') ?
+    constants[key] :
+    0),
+));
+
 const brotliInitParamsArray = new Uint32Array(kMaxBrotliParam + 1);
 
 const brotliDefaultOpts = {
@@ -888,6 +1261,87 @@ ObjectSetPrototypeOf(BrotliDecompress.prototype, Brotli.prototype);
 ObjectSetPrototypeOf(BrotliDecompress, Brotli);
 
 
+const zstdDefaultOpts = {
+  flush: ZSTD_e_continue,
+  finishFlush: ZSTD_e_end,
+  fullFlush: ZSTD_e_flush,
+};
+function Zstd(opts, mode) {
+  assert(mode === ZSTD_COMPRESS || mode === ZSTD_DECOMPRESS);
+
+  // Zstd is not bundled; it is only available when Node.js was configured
+  // with --shared-zstd.
+  if (binding.ZstdCompress === undefined)
+    throw new ERR_NO_ZSTD();
+
+  const params = [];
+  if (opts?.params) {
+    const seen = new SafeSet();
+    ArrayPrototypeForEach(ObjectKeys(opts.params), (origKey) => {
+      const key = +origKey;
+      if (!NumberIsInteger(key) || key < 0 || key > kMaxZstdParam ||
+          seen.has(key)) {
+        throw new ERR_ZSTD_INVALID_PARAM(origKey);
+      }
+
+      const value = opts.params[origKey];
+      if (typeof value !== 'number' && typeof value !== 'boolean') {
+        throw new ERR_INVALID_ARG_TYPE('options.params[key]',
+                                       'number', opts.params[origKey]);
+      }
+      seen.add(key);
+      ArrayPrototypePush(params, key, +value);
+    });
+  }
+
+  let pledgedSrcSize;
+  if (opts?.pledgedSrcSize !== undefined) {
+    pledgedSrcSize = opts.pledgedSrcSize;
+    validateInteger(pledgedSrcSize, 'options.pledgedSrcSize', 0);
+  }
+
+  const handle = mode === ZSTD_COMPRESS ?
+    new binding.ZstdCompress(mode) : new binding.ZstdDecompress(mode);
+
+  this._writeState = new Uint32Array(2);
+  if (!handle.init(new Int32Array(params),
+                   pledgedSrcSize,
+                   this._writeState,
+                   processCallback)) {
+    throw new ERR_ZLIB_INITIALIZATION_FAILED();
+  }
+
+  ReflectApply(ZlibBase, this, [opts, mode, handle, zstdDefaultOpts]);
+}
+ObjectSetPrototypeOf(Zstd.prototype, Zlib.prototype);
+ObjectSetPrototypeOf(Zstd, Zlib);
+
+function ZstdCompress(opts) {
+  if (!(this instanceof ZstdCompress))
+    return new ZstdCompress(opts);
+  ReflectApply(Zstd, this, [opts, ZSTD_COMPRESS]);
+}
+ObjectSetPrototypeOf(ZstdCompress.prototype, Zstd.prototype);
+ObjectSetPrototypeOf(ZstdCompress, Zstd);
+
+function ZstdDecompress(opts) {
+  if (!(this instanceof ZstdDecompress))
+    return new ZstdDecompress(opts);
+  ReflectApply(Zstd, this, [opts, ZSTD_DECOMPRESS]);
+}
+ObjectSetPrototypeOf(ZstdDecompress.prototype, Zstd.prototype);
+ObjectSetPrototypeOf(ZstdDecompress, Zstd);
+
+
+function crc32(data, value = 0) {
+  if (typeof data !== 'string' && !isArrayBufferView(data)) {
+    throw new ERR_INVALID_ARG_TYPE(
+      'data', ['Buffer', 'TypedArray', 'DataView', 'string'], data);
+  }
+  validateUint32(value, 'value');
+  return binding.crc32(data, value);
+}
+
 function createProperty(ctor) {
   return {
     __proto__: null,
@@ -917,6 +1371,9 @@ module.exports = {
   Unzip,
   BrotliCompress,
   BrotliDecompress,
+  ZstdCompress,
+  ZstdDecompress,
+  Dictionary,
 
   // Convenience methods.
   // compress/decompress a string or buffer in one step.
@@ -938,6 +1395,12 @@ module.exports = {
   brotliCompressSync: createConvenienceMethod(BrotliCompress, true),
   brotliDecompress: createConvenienceMethod(BrotliDecompress, false),
   brotliDecompressSync: createConvenienceMethod(BrotliDecompress, true),
+  zstdCompress: createConvenienceMethod(ZstdCompress, false),
+  zstdCompressSync: createConvenienceMethod(ZstdCompress, true),
+  zstdDecompress: createConvenienceMethod(ZstdDecompress, false),
+  zstdDecompressSync: createConvenienceMethod(ZstdDecompress, true),
+
+  crc32,
 };
 
 ObjectDefineProperties(module.exports, {
@@ -950,6 +1413,8 @@ ObjectDefineProperties(module.exports, {
   createUnzip: createProperty(Unzip),
   createBrotliCompress: createProperty(BrotliCompress),
   createBrotliDecompress: createProperty(BrotliDecompress),
+  createZstdCompress: createProperty(ZstdCompress),
+  createZstdDecompress: createProperty(ZstdDecompress),
   constants: {
     __proto__: null,
     configurable: false,
@@ -967,7 +1432,8 @@ ObjectDefineProperties(module.exports, {
 // These should be considered deprecated
 // expose all the zlib constants
 for (const bkey of ObjectKeys(constants)) {
-  if (StringPrototypeStartsWith(bkey, 'BROTLI')) continue;
+  if (StringPrototypeStartsWith(bkey, 'BROTLI') ||
+      StringPrototypeStartsWith(bkey, 'ZSTD')) continue;
   ObjectDefineProperty(module.exports, bkey, {
     __proto__: null,
     enumerable: false, value: constants[bkey], writable: false,
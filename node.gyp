@@ -16,6 +16,7 @@
     'ossfuzz' : 'false',
     'node_module_version%': '',
     'node_shared_brotli%': 'false',
+    'node_shared_zstd%': 'false',
     'node_shared_zlib%': 'false',
     'node_shared_http_parser%': 'false',
     'node_shared_cares%': 'false',
@@ -509,10 +510,12 @@
         'src/api/exceptions.cc',
         'src/api/hooks.cc',
         'src/api/utils.cc',
+        'src/array_buffer_pool.cc',
         'src/async_wrap.cc',
         'src/base_object.cc',
         'src/cares_wrap.cc',
         'src/cleanup_queue.cc',
+        'src/compile_cache.cc',
         'src/connect_wrap.cc',
         'src/connection_wrap.cc',
         'src/debug_utils.cc',
@@ -581,8 +584,10 @@
         'src/node_watchdog.cc',
         'src/node_worker.cc',
         'src/node_zlib.cc',
+        'src/package_json_parser.cc',
         'src/pipe_wrap.cc',
         'src/process_wrap.cc',
+        'src/resolution_cache.cc',
         'src/signal_wrap.cc',
         'src/spawn_sync.cc',
         'src/stream_base.cc',
@@ -607,6 +612,7 @@
         'src/aliased_buffer-inl.h',
         'src/aliased_struct.h',
         'src/aliased_struct-inl.h',
+        'src/array_buffer_pool.h',
         'src/async_wrap.h',
         'src/async_wrap-inl.h',
         'src/base_object.h',
@@ -617,6 +623,7 @@
         'src/callback_queue.h',
         'src/callback_queue-inl.h',
         'src/cleanup_queue.h',
+        'src/compile_cache.h',
         'src/cleanup_queue-inl.h',
         'src/connect_wrap.h',
         'src/connection_wrap.h',
@@ -691,9 +698,11 @@
         'src/node_wasi.h',
         'src/node_watchdog.h',
         'src/node_worker.h',
+        'src/package_json_parser.h',
         'src/pipe_wrap.h',
         'src/req_wrap.h',
         'src/req_wrap-inl.h',
+        'src/resolution_cache.h',
         'src/spawn_sync.h',
         'src/stream_base.h',
         'src/stream_base-inl.h',
@@ -926,6 +935,24 @@
             'src/node_crypto.cc',
             'src/node_crypto.h'
           ],
+          'actions': [
+            {
+              'action_name': 'node_root_certs_der',
+              'inputs': [
+                'tools/mkrootcertsder.py',
+                'src/node_root_certs.h',
+              ],
+              'outputs': [
+                '<(SHARED_INTERMEDIATE_DIR)/node_root_certs_der.h',
+              ],
+              'action': [
+                '<(python)',
+                'tools/mkrootcertsder.py',
+                'src/node_root_certs.h',
+                '<@(_outputs)',
+              ],
+            },
+          ],
         }],
         [ 'OS in "linux freebsd solaris" and '
           'target_arch=="x64" and '
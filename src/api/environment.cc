@@ -98,9 +98,21 @@ MaybeLocal<Value> PrepareStackTraceCallback(Local<Context> context,
   return result;
 }
 
+NodeArrayBufferAllocator::NodeArrayBufferAllocator() {
+  const int64_t pool_size = per_process::cli_options->array_buffer_pool_size;
+  if (pool_size > 0) {
+    pool_ = std::make_unique<ArrayBufferPool>(allocator_.get(),
+                                              static_cast<size_t>(pool_size));
+  }
+}
+
 void* NodeArrayBufferAllocator::Allocate(size_t size) {
   void* ret;
-  if (zero_fill_field_ || per_process::cli_options->zero_fill_all_buffers)
+  const bool zero_fill =
+      zero_fill_field_ || per_process::cli_options->zero_fill_all_buffers;
+  if (pool_ && ArrayBufferPool::IsPooled(size))
+    ret = pool_->Allocate(size, zero_fill);
+  else if (zero_fill)
     ret = allocator_->Allocate(size);
   else
     ret = allocator_->AllocateUninitialized(size);
@@ -110,7 +122,11 @@ void* NodeArrayBufferAllocator::Allocate(size_t size) {
 }
 
 void* NodeArrayBufferAllocator::AllocateUninitialized(size_t size) {
-  void* ret = allocator_->AllocateUninitialized(size);
+  void* ret;
+  if (pool_ && ArrayBufferPool::IsPooled(size))
+    ret = pool_->Allocate(size, false);
+  else
+    ret = allocator_->AllocateUninitialized(size);
   if (LIKELY(ret != nullptr))
     total_mem_usage_.fetch_add(size, std::memory_order_relaxed);
   return ret;
@@ -118,6 +134,23 @@ void* NodeArrayBufferAllocator::AllocateUninitialized(size_t size) {
 
 void* NodeArrayBufferAllocator::Reallocate(
     void* data, size_t old_size, size_t size) {
+  if (pool_ && (ArrayBufferPool::IsPooled(old_size) ||
+                ArrayBufferPool::IsPooled(size))) {
+    // Pooled blocks cannot be passed to the underlying allocator, so move the
+    // contents by hand. This calls the methods of this class directly, as the
+    // subclass that tracks allocations does its own bookkeeping around this.
+    void* ret = NodeArrayBufferAllocator::AllocateUninitialized(size);
+    // Like realloc(), a zero-size reallocation releases |data| even if the
+    // allocator returns nullptr for it.
+    if (ret == nullptr && size != 0) return nullptr;
+    if (size != 0) {
+      memcpy(ret, data, std::min(old_size, size));
+      if (size > old_size)
+        memset(static_cast<char*>(ret) + old_size, 0, size - old_size);
+    }
+    NodeArrayBufferAllocator::Free(data, old_size);
+    return ret;
+  }
   void* ret = allocator_->Reallocate(data, old_size, size);
   if (LIKELY(ret != nullptr) || UNLIKELY(size == 0))
     total_mem_usage_.fetch_add(size - old_size, std::memory_order_relaxed);
@@ -126,7 +159,10 @@ void* NodeArrayBufferAllocator::Reallocate(
 
 void NodeArrayBufferAllocator::Free(void* data, size_t size) {
   total_mem_usage_.fetch_sub(size, std::memory_order_relaxed);
-  allocator_->Free(data, size);
+  if (pool_ && ArrayBufferPool::IsPooled(size))
+    pool_->Free(data, size);
+  else
+    allocator_->Free(data, size);
 }
 
 DebuggingArrayBufferAllocator::~DebuggingArrayBufferAllocator() {
@@ -489,6 +525,8 @@ MaybeLocal<Value> LoadEnvironment(
     StartExecutionCallback cb) {
   env->InitializeLibuv();
   env->InitializeDiagnostics();
+  env->InitializeCompileCache();
+  env->InitializeResolutionCache();
 
   return StartExecution(env, cb);
 }
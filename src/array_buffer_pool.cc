@@ -0,0 +1,84 @@
+#include "array_buffer_pool.h"
+#include "util.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace node {
+
+ArrayBufferPool::ArrayBufferPool(v8::ArrayBuffer::Allocator* allocator,
+                                 size_t max_cached_bytes)
+    : allocator_(allocator), max_cached_bytes_(max_cached_bytes) {}
+
+ArrayBufferPool::~ArrayBufferPool() {
+  for (size_t i = 0; i < size_classes_.size(); i++) {
+    for (void* block : size_classes_[i].blocks)
+      allocator_->Free(block, kBlockSizes[i]);
+  }
+}
+
+bool ArrayBufferPool::IsPooled(size_t size) {
+  return size >= kMinPooledSize && size <= kBlockSizes.back();
+}
+
+size_t ArrayBufferPool::SizeClassIndex(size_t size) {
+  DCHECK(IsPooled(size));
+  return std::lower_bound(kBlockSizes.begin(), kBlockSizes.end(), size) -
+         kBlockSizes.begin();
+}
+
+void* ArrayBufferPool::Allocate(size_t size, bool zero_fill) {
+  const size_t index = SizeClassIndex(size);
+  SizeClass& size_class = size_classes_[index];
+  void* data = nullptr;
+  {
+    Mutex::ScopedLock lock(mutex_);
+    if (!size_class.blocks.empty()) {
+      data = size_class.blocks.back();
+      size_class.blocks.pop_back();
+      cached_bytes_ -= kBlockSizes[index];
+      size_class.hits++;
+    } else {
+      size_class.misses++;
+    }
+  }
+
+  if (data == nullptr) {
+    return zero_fill ? allocator_->Allocate(kBlockSizes[index])
+                     : allocator_->AllocateUninitialized(kBlockSizes[index]);
+  }
+  // Only the part of the block that is visible to JS needs to be cleared.
+  if (zero_fill) memset(data, 0, size);
+  return data;
+}
+
+void ArrayBufferPool::Free(void* data, size_t size) {
+  if (data == nullptr) return;
+  const size_t index = SizeClassIndex(size);
+  {
+    Mutex::ScopedLock lock(mutex_);
+    if (cached_bytes_ + kBlockSizes[index] <= max_cached_bytes_) {
+      size_classes_[index].blocks.push_back(data);
+      cached_bytes_ += kBlockSizes[index];
+      return;
+    }
+  }
+  allocator_->Free(data, kBlockSizes[index]);
+}
+
+std::vector<ArrayBufferPool::SizeClassStats> ArrayBufferPool::GetStats()
+    const {
+  std::vector<SizeClassStats> stats;
+  stats.reserve(size_classes_.size());
+  Mutex::ScopedLock lock(mutex_);
+  for (size_t i = 0; i < size_classes_.size(); i++) {
+    const SizeClass& size_class = size_classes_[i];
+    stats.push_back({kBlockSizes[i],
+                     size_class.hits,
+                     size_class.misses,
+                     size_class.blocks.size()});
+  }
+  return stats;
+}
+
+}  // namespace node
@@ -0,0 +1,82 @@
+#ifndef SRC_ARRAY_BUFFER_POOL_H_
+#define SRC_ARRAY_BUFFER_POOL_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "node_mutex.h"
+#include "v8.h"
+
+namespace node {
+
+// Keeps the memory of freed medium-sized ArrayBuffers around for reuse, sorted
+// into size classes, so that code that keeps allocating buffers of similar
+// sizes does not go through the underlying allocator every time. Every
+// allocation is rounded up to the block size of its class, and at most
+// |max_cached_bytes| of blocks are kept at any time.
+//
+// Each NodeArrayBufferAllocator has its own pool, so in practice there is one
+// pool per Node.js thread. The pool is locked nevertheless, because V8 may
+// free backing stores on its own background threads.
+class ArrayBufferPool {
+ public:
+  struct SizeClassStats {
+    size_t block_size;
+    // Allocations that were served from a cached block.
+    uint64_t hits;
+    // Allocations that needed a new block from the underlying allocator.
+    uint64_t misses;
+    size_t cached_blocks;
+  };
+
+  ArrayBufferPool(v8::ArrayBuffer::Allocator* allocator,
+                  size_t max_cached_bytes);
+  ~ArrayBufferPool();
+
+  ArrayBufferPool(const ArrayBufferPool&) = delete;
+  ArrayBufferPool& operator=(const ArrayBufferPool&) = delete;
+
+  // Returns whether allocations of |size| bytes are served by the pool.
+  static bool IsPooled(size_t size);
+
+  // These may only be called with sizes for which IsPooled() returns true.
+  // Free() must be passed the size that the memory was allocated with.
+  void* Allocate(size_t size, bool zero_fill);
+  void Free(void* data, size_t size);
+
+  std::vector<SizeClassStats> GetStats() const;
+  size_t max_cached_bytes() const { return max_cached_bytes_; }
+
+ private:
+  // Block sizes grow by factors of 1.5 and 4/3 in turn, so that no more than a
+  // third of a block is wasted on rounding up.
+  static constexpr std::array<size_t, 11> kBlockSizes = {
+      2 * 1024, 3 * 1024, 4 * 1024, 6 * 1024, 8 * 1024, 12 * 1024,
+      16 * 1024, 24 * 1024, 32 * 1024, 48 * 1024, 64 * 1024};
+  // Smaller allocations are cheap enough without pooling.
+  static constexpr size_t kMinPooledSize = 1024 + 1;
+
+  struct SizeClass {
+    std::vector<void*> blocks;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+  };
+
+  static size_t SizeClassIndex(size_t size);
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  const size_t max_cached_bytes_;
+  mutable Mutex mutex_;
+  // Everything below is protected by mutex_.
+  size_t cached_bytes_ = 0;
+  std::array<SizeClass, kBlockSizes.size()> size_classes_;
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_ARRAY_BUFFER_POOL_H_
@@ -0,0 +1,264 @@
+#include "compile_cache.h"
+#include "debug_utils-inl.h"
+#include "env-inl.h"
+#include "node_file.h"
+#include "node_internals.h"
+#include "node_metadata.h"
+#include "node_version.h"
+#include "util-inl.h"
+#include "zlib.h"
+
+#include <cstring>
+
+namespace node {
+
+using v8::Function;
+using v8::HandleScope;
+using v8::Local;
+using v8::Module;
+using v8::ScriptCompiler;
+using v8::String;
+
+namespace {
+
+uint32_t GetCacheKey(const std::string& filename, CachedCodeType type) {
+  uLong crc = crc32(0L, Z_NULL, 0);
+  crc = crc32(crc, reinterpret_cast<const Bytef*>(&type), sizeof(type));
+  crc = crc32(
+      crc, reinterpret_cast<const Bytef*>(filename.data()), filename.size());
+  return crc;
+}
+
+// V8 rejects code cache produced by other versions or with other flags.
+// Keep the caches of different versions apart instead of having them
+// overwrite each other when an application is run by several of them.
+std::string GetCacheVersionTag() {
+  return SPrintF("%s-%s-%x",
+                 NODE_VERSION,
+                 per_process::metadata.arch,
+                 ScriptCompiler::CachedDataVersionTag());
+}
+
+}  // anonymous namespace
+
+ScriptCompiler::CachedData* CompileCacheEntry::CopyCache() const {
+  DCHECK_NOT_NULL(cache);
+  return new ScriptCompiler::CachedData(
+      cache->data, cache->length, ScriptCompiler::CachedData::BufferNotOwned);
+}
+
+CompileCacheHandler::CompileCacheHandler(Environment* env)
+    : isolate_(env->isolate()),
+      env_(env),
+      is_debug_(
+          env->enabled_debug_list()->enabled(DebugCategory::COMPILE_CACHE)) {}
+
+template <typename... Args>
+inline void CompileCacheHandler::Debug(const char* format,
+                                       Args&&... args) const {
+  if (UNLIKELY(is_debug_)) {
+    FPrintF(stderr, format, std::forward<Args>(args)...);
+  }
+}
+
+bool CompileCacheHandler::InitializeDirectory(const std::string& dir) {
+  std::string cache_dir = dir + kPathSeparator + GetCacheVersionTag();
+  fs::FSReqWrapSync req_wrap;
+  int err = fs::MKDirpSync(nullptr, &req_wrap.req, cache_dir, 0777, nullptr);
+  if (err < 0 && err != UV_EEXIST) {
+    Debug("[compile cache] failed to create %s: %s\n",
+          cache_dir,
+          uv_strerror(err));
+    return false;
+  }
+
+  // Resolve the directory now, in case the application changes its working
+  // directory before the cache is persisted.
+  fs::FSReqWrapSync realpath_req;
+  err = uv_fs_realpath(nullptr, &realpath_req.req, cache_dir.c_str(), nullptr);
+  if (err < 0) {
+    Debug("[compile cache] failed to resolve %s: %s\n",
+          cache_dir,
+          uv_strerror(err));
+    return false;
+  }
+  cache_dir_ = static_cast<const char*>(realpath_req.req.ptr);
+  Debug("[compile cache] using %s\n", cache_dir_);
+  return true;
+}
+
+CompileCacheEntry* CompileCacheHandler::GetOrInsert(Local<String> code,
+                                                    Local<String> filename,
+                                                    CachedCodeType type) {
+  Utf8Value filename_utf8(isolate_, filename);
+  std::string source_filename = filename_utf8.ToString();
+  // Only cache the code of actual files.
+  if (source_filename.empty()) return nullptr;
+
+  Utf8Value code_utf8(isolate_, code);
+  uint32_t code_size = code_utf8.length();
+  uint32_t code_hash = GetCrc32(*code_utf8, code_utf8.length());
+  uint32_t key = GetCacheKey(source_filename, type);
+
+  auto it = compiler_cache_store_.find(key);
+  if (it != compiler_cache_store_.end() && it->second->code_size == code_size &&
+      it->second->code_hash == code_hash &&
+      it->second->source_filename == source_filename) {
+    Debug("[compile cache] reusing in-memory entry for %s\n", source_filename);
+    return it->second.get();
+  }
+
+  auto entry = std::make_unique<CompileCacheEntry>();
+  entry->cache_key = key;
+  entry->code_hash = code_hash;
+  entry->code_size = code_size;
+  entry->cache_filename = cache_dir_ + kPathSeparator + SPrintF("%x", key);
+  entry->source_filename = std::move(source_filename);
+  entry->type = type;
+  ReadCacheFile(entry.get());
+
+  CompileCacheEntry* result = entry.get();
+  compiler_cache_store_[key] = std::move(entry);
+  return result;
+}
+
+void CompileCacheHandler::ReadCacheFile(CompileCacheEntry* entry) {
+  std::string contents;
+  int err = ReadFileSync(&contents, entry->cache_filename.c_str());
+  if (err < 0) {
+    Debug("[compile cache] no cache for %s at %s: %s\n",
+          entry->source_filename,
+          entry->cache_filename,
+          uv_strerror(err));
+    return;
+  }
+
+  uint32_t headers[kHeaderCount];
+  if (contents.size() < sizeof(headers)) {
+    Debug("[compile cache] cache for %s is truncated\n",
+          entry->source_filename);
+    return;
+  }
+  memcpy(headers, contents.data(), sizeof(headers));
+
+  if (headers[kMagicIndex] != kMagic ||
+      headers[kCodeSizeIndex] != entry->code_size ||
+      headers[kCodeHashIndex] != entry->code_hash) {
+    // The source has been changed since the cache was written.
+    Debug("[compile cache] cache for %s is for a different source\n",
+          entry->source_filename);
+    return;
+  }
+
+  const char* cache_data = contents.data() + sizeof(headers);
+  size_t cache_size = contents.size() - sizeof(headers);
+  if (headers[kCacheSizeIndex] != cache_size ||
+      headers[kCacheHashIndex] != GetCrc32(cache_data, cache_size)) {
+    Debug("[compile cache] cache for %s is corrupted\n",
+          entry->source_filename);
+    return;
+  }
+
+  uint8_t* buffer = new uint8_t[cache_size];
+  memcpy(buffer, cache_data, cache_size);
+  entry->cache = std::make_unique<ScriptCompiler::CachedData>(
+      buffer, cache_size, ScriptCompiler::CachedData::BufferOwned);
+  Debug("[compile cache] read %zu bytes of cache for %s\n",
+        cache_size,
+        entry->source_filename);
+}
+
+void CompileCacheHandler::MarkRefreshed(CompileCacheEntry* entry,
+                                        bool rejected) {
+  if (entry->cache == nullptr) {
+    stats_.misses++;
+  } else if (rejected) {
+    stats_.rejected++;
+    Debug("[compile cache] cache for %s was rejected\n",
+          entry->source_filename);
+    entry->cache.reset();
+  } else {
+    stats_.hits++;
+    Debug("[compile cache] cache for %s was accepted\n",
+          entry->source_filename);
+    return;
+  }
+  entry->refreshed = true;
+}
+
+void CompileCacheHandler::MaybeSave(CompileCacheEntry* entry,
+                                    Local<Function> func,
+                                    bool rejected) {
+  DCHECK_EQ(entry->type, CachedCodeType::kCommonJS);
+  MarkRefreshed(entry, rejected);
+  if (entry->refreshed) entry->function.Reset(isolate_, func);
+}
+
+void CompileCacheHandler::MaybeSave(CompileCacheEntry* entry,
+                                    Local<Module> mod,
+                                    bool rejected) {
+  DCHECK_EQ(entry->type, CachedCodeType::kESM);
+  MarkRefreshed(entry, rejected);
+  // The unbound script can only be obtained before the module is evaluated.
+  if (entry->refreshed)
+    entry->module_script.Reset(isolate_, mod->GetUnboundModuleScript());
+}
+
+void CompileCacheHandler::Persist() {
+  HandleScope handle_scope(isolate_);
+  for (auto& item : compiler_cache_store_) {
+    CompileCacheEntry* entry = item.second.get();
+    if (!entry->refreshed) continue;
+    entry->refreshed = false;
+
+    std::unique_ptr<ScriptCompiler::CachedData> data;
+    if (!entry->function.IsEmpty()) {
+      data.reset(ScriptCompiler::CreateCodeCacheForFunction(
+          entry->function.Get(isolate_)));
+    } else if (!entry->module_script.IsEmpty()) {
+      data.reset(
+          ScriptCompiler::CreateCodeCache(entry->module_script.Get(isolate_)));
+    }
+    entry->function.Reset();
+    entry->module_script.Reset();
+
+    if (!data) {
+      Debug("[compile cache] failed to produce cache for %s\n",
+            entry->source_filename);
+      continue;
+    }
+    if (WriteCacheFile(entry, data.get())) {
+      stats_.written++;
+      Debug("[compile cache] wrote %d bytes of cache for %s\n",
+            data->length,
+            entry->source_filename);
+    }
+  }
+}
+
+bool CompileCacheHandler::WriteCacheFile(
+    CompileCacheEntry* entry, const ScriptCompiler::CachedData* data) {
+  uint32_t headers[kHeaderCount];
+  headers[kMagicIndex] = kMagic;
+  headers[kCodeSizeIndex] = entry->code_size;
+  headers[kCodeHashIndex] = entry->code_hash;
+  headers[kCacheSizeIndex] = data->length;
+  headers[kCacheHashIndex] =
+      GetCrc32(reinterpret_cast<const char*>(data->data), data->length);
+
+  std::string contents(reinterpret_cast<const char*>(headers),
+                       sizeof(headers));
+  contents.append(reinterpret_cast<const char*>(data->data), data->length);
+
+  int err = WriteFileSyncAtomically(
+      entry->cache_filename, contents, env_->thread_id());
+  if (err != 0) {
+    Debug("[compile cache] failed to write %s: %s\n",
+          entry->cache_filename,
+          uv_strerror(err));
+    return false;
+  }
+  return true;
+}
+
+}  // namespace node
@@ -0,0 +1,109 @@
+#ifndef SRC_COMPILE_CACHE_H_
+#define SRC_COMPILE_CACHE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <cinttypes>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "v8.h"
+
+namespace node {
+class Environment;
+
+enum class CachedCodeType : uint8_t {
+  kCommonJS = 0,
+  kESM,
+};
+
+struct CompileCacheEntry {
+  // Code cache read from the cache directory, if any.
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache{nullptr};
+  uint32_t cache_key;
+  uint32_t code_hash;
+  uint32_t code_size;
+  std::string cache_filename;
+  std::string source_filename;
+  CachedCodeType type;
+  // Whether the code cache has to be (re-)written to the cache directory.
+  bool refreshed = false;
+  // The code cache is only produced when it is persisted, so that it
+  // includes the functions that have been compiled lazily by then.
+  v8::Global<v8::Function> function;
+  v8::Global<v8::UnboundModuleScript> module_script;
+
+  // Copy the cache into a new v8::ScriptCompiler::CachedData that does not
+  // own the underlying buffer, to be passed to a v8::ScriptCompiler::Source.
+  v8::ScriptCompiler::CachedData* CopyCache() const;
+};
+
+struct CompileCacheStats {
+  // Modules compiled with an accepted code cache.
+  uint32_t hits = 0;
+  // Modules without a usable code cache file, including files for an older
+  // version of the source and truncated or corrupted files.
+  uint32_t misses = 0;
+  // Modules whose code cache was read but rejected by V8.
+  uint32_t rejected = 0;
+  // Code cache files written to the cache directory.
+  uint32_t written = 0;
+};
+
+// Persists the V8 code cache of user modules in a directory, so that later
+// runs of the same application can skip compiling them from scratch.
+// The cache files are located in a sub-directory that is specific to the
+// Node.js version and to the V8 flags, and are keyed by the file name of the
+// modules. The source is checked against the hash stored in the cache file.
+class CompileCacheHandler {
+ public:
+  explicit CompileCacheHandler(Environment* env);
+  bool InitializeDirectory(const std::string& dir);
+
+  // Returns nullptr if the code cannot be cached.
+  CompileCacheEntry* GetOrInsert(v8::Local<v8::String> code,
+                                 v8::Local<v8::String> filename,
+                                 CachedCodeType type);
+  void MaybeSave(CompileCacheEntry* entry,
+                 v8::Local<v8::Function> func,
+                 bool rejected);
+  void MaybeSave(CompileCacheEntry* entry,
+                 v8::Local<v8::Module> mod,
+                 bool rejected);
+  // Writes the code cache of the modules compiled without an accepted cache.
+  void Persist();
+
+  const std::string& cache_dir() const { return cache_dir_; }
+  const CompileCacheStats& stats() const { return stats_; }
+
+ private:
+  void ReadCacheFile(CompileCacheEntry* entry);
+  bool WriteCacheFile(CompileCacheEntry* entry,
+                      const v8::ScriptCompiler::CachedData* data);
+  void MarkRefreshed(CompileCacheEntry* entry, bool rejected);
+
+  template <typename... Args>
+  inline void Debug(const char* format, Args&&... args) const;
+
+  static constexpr size_t kMagicIndex = 0;
+  static constexpr size_t kCodeSizeIndex = 1;
+  static constexpr size_t kCodeHashIndex = 2;
+  static constexpr size_t kCacheSizeIndex = 3;
+  static constexpr size_t kCacheHashIndex = 4;
+  static constexpr size_t kHeaderCount = 5;
+  static constexpr uint32_t kMagic = 0x1C0DECAC;
+
+  v8::Isolate* isolate_ = nullptr;
+  Environment* env_ = nullptr;
+  bool is_debug_ = false;
+
+  std::string cache_dir_;
+  CompileCacheStats stats_;
+  std::unordered_map<uint32_t, std::unique_ptr<CompileCacheEntry>>
+      compiler_cache_store_;
+};
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_COMPILE_CACHE_H_
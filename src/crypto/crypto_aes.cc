@@ -555,7 +555,7 @@ Maybe<bool> AESCipherTraits::AdditionalConfig(
       UNREACHABLE();
   }
 
-  params->cipher = EVP_get_cipherbynid(cipher_nid);
+  params->cipher = GetCipherImplementation(cipher_nid);
   if (params->cipher == nullptr) {
     THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env);
     return Nothing<bool>();
@@ -1,4 +1,5 @@
 #include "crypto/crypto_cipher.h"
+#include "async_wrap-inl.h"
 #include "base_object-inl.h"
 #include "crypto/crypto_util.h"
 #include "env-inl.h"
@@ -7,6 +8,7 @@
 #include "node_internals.h"
 #include "node_process-inl.h"
 #include "node_revert.h"
+#include "threadpoolwork-inl.h"
 #include "v8.h"
 
 namespace node {
@@ -20,7 +22,10 @@ using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Int32;
 using v8::Isolate;
+using v8::Just;
 using v8::Local;
+using v8::Maybe;
+using v8::Nothing;
 using v8::Object;
 using v8::Uint32;
 using v8::Value;
@@ -62,10 +67,10 @@ void GetCipherInfo(const FunctionCallbackInfo<Value>& args) {
   const EVP_CIPHER* cipher;
   if (args[1]->IsString()) {
     Utf8Value name(env->isolate(), args[1]);
-    cipher = EVP_get_cipherbyname(*name);
+    cipher = GetCipherImplementation(*name);
   } else {
     int nid = args[1].As<Int32>()->Value();
-    cipher = EVP_get_cipherbynid(nid);
+    cipher = GetCipherImplementation(nid);
   }
 
   if (cipher == nullptr)
@@ -416,7 +421,7 @@ void CipherBase::Init(const char* cipher_type,
         "crypto.createCipher() is not supported in FIPS mode.");
   }
 
-  const EVP_CIPHER* const cipher = EVP_get_cipherbyname(cipher_type);
+  const EVP_CIPHER* const cipher = GetCipherImplementation(cipher_type);
   if (cipher == nullptr)
     return THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env());
 
@@ -480,7 +485,7 @@ void CipherBase::InitIv(const char* cipher_type,
   HandleScope scope(env()->isolate());
   MarkPopErrorOnReturn mark_pop_error_on_return;
 
-  const EVP_CIPHER* const cipher = EVP_get_cipherbyname(cipher_type);
+  const EVP_CIPHER* const cipher = GetCipherImplementation(cipher_type);
   if (cipher == nullptr)
     return THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env());
 
@@ -1085,7 +1090,7 @@ void PublicKeyCipher::Cipher(const FunctionCallbackInfo<Value>& args) {
   const EVP_MD* digest = nullptr;
   if (args[offset + 2]->IsString()) {
     const Utf8Value oaep_str(env->isolate(), args[offset + 2]);
-    digest = EVP_get_digestbyname(*oaep_str);
+    digest = GetDigestImplementation(*oaep_str);
     if (digest == nullptr)
       return THROW_ERR_OSSL_EVP_INVALID_DIGEST(env);
   }
@@ -1106,5 +1111,438 @@ void PublicKeyCipher::Cipher(const FunctionCallbackInfo<Value>& args) {
       Buffer::New(env, ab, 0, ab->ByteLength()).FromMaybe(Local<Value>()));
 }
 
+
+namespace {
+// The largest IV that the OpenSSL 3 GCM implementation accepts.
+constexpr size_t kMaxGCMIVLength = 128;
+// OpenSSL 3 only accepts the 96-bit nonces of RFC 8439 once the key is set.
+constexpr size_t kChaCha20Poly1305IVLength = 12;
+
+// Copies the offsets that delimit the messages of a batch. They have already
+// been validated in JS land.
+void CopyBatchOffsets(Local<Value> value,
+                      size_t byte_length,
+                      std::vector<uint32_t>* offsets) {
+  CHECK(value->IsUint32Array());
+  ArrayBufferViewContents<char> contents(value);
+  offsets->resize(contents.length() / sizeof(uint32_t));
+  CHECK_GE(offsets->size(), 1);
+  memcpy(offsets->data(), contents.data(), contents.length());
+  for (size_t i = 1; i < offsets->size(); i++)
+    CHECK_LE((*offsets)[i - 1], (*offsets)[i]);
+  CHECK_LE(offsets->back(), byte_length);
+}
+
+AEADMessage GetBatchMessage(const AEADBatchConfig& params, size_t i) {
+  return AEADMessage {
+    params.iv.data<unsigned char>() + params.iv_offsets[i],
+    params.iv_offsets[i + 1] - params.iv_offsets[i],
+    params.aad.data<unsigned char>() + params.aad_offsets[i],
+    params.aad_offsets[i + 1] - params.aad_offsets[i],
+    params.data.data<unsigned char>() + params.data_offsets[i],
+    params.data_offsets[i + 1] - params.data_offsets[i],
+  };
+}
+
+size_t GetAEADOutputLength(size_t data_len,
+                           unsigned int auth_tag_len,
+                           bool encrypt) {
+  if (encrypt)
+    return data_len + auth_tag_len;
+  return data_len > auth_tag_len ? data_len - auth_tag_len : 0;
+}
+}  // namespace
+
+AEADKeySchedule::AEADKeySchedule(CipherCtxPointer&& ctx,
+                                 unsigned int auth_tag_len)
+    : template_(std::move(ctx)),
+      auth_tag_len_(auth_tag_len),
+      is_chacha20_poly1305_(
+          EVP_CIPHER_CTX_nid(template_.get()) == NID_chacha20_poly1305) {}
+
+bool AEADKeySchedule::IsValidIVLength(size_t iv_len) const {
+  if (is_chacha20_poly1305_)
+    return iv_len == kChaCha20Poly1305IVLength;
+  return iv_len > 0 && iv_len <= kMaxGCMIVLength;
+}
+
+bool AEADKeySchedule::Begin(EVP_CIPHER_CTX* ctx,
+                            const AEADMessage& message,
+                            bool encrypt) const {
+  if (!IsValidIVLength(message.iv_len) ||
+      message.aad_len > INT_MAX ||
+      message.data_len > INT_MAX ||
+      !EVP_CIPHER_CTX_copy(ctx, template_.get())) {
+    return false;
+  }
+
+  if (static_cast<int>(message.iv_len) != EVP_CIPHER_CTX_iv_length(ctx) &&
+      !EVP_CIPHER_CTX_ctrl(ctx,
+                           EVP_CTRL_AEAD_SET_IVLEN,
+                           message.iv_len,
+                           nullptr)) {
+    return false;
+  }
+
+  // Only the IV and the direction change, the key schedule is kept.
+  if (!EVP_CipherInit_ex(ctx, nullptr, nullptr, nullptr, message.iv, encrypt))
+    return false;
+
+  int out_len;
+  return message.aad_len == 0 ||
+         EVP_CipherUpdate(ctx, nullptr, &out_len, message.aad,
+                          message.aad_len) == 1;
+}
+
+bool AEADKeySchedule::Seal(EVP_CIPHER_CTX* ctx,
+                           const AEADMessage& message,
+                           unsigned char* out) const {
+  if (!Begin(ctx, message, true))
+    return false;
+
+  int out_len;
+  if (message.data_len > 0 &&
+      EVP_CipherUpdate(ctx, out, &out_len, message.data,
+                       message.data_len) != 1) {
+    return false;
+  }
+
+  // Both GCM and ChaCha20-Poly1305 are stream ciphers, so nothing is written
+  // by EVP_CipherFinal_ex().
+  unsigned char* tag = out + message.data_len;
+  return EVP_CipherFinal_ex(ctx, tag, &out_len) == 1 &&
+         EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, auth_tag_len_,
+                             tag) == 1;
+}
+
+bool AEADKeySchedule::Open(EVP_CIPHER_CTX* ctx,
+                           const AEADMessage& message,
+                           unsigned char* out) const {
+  if (message.data_len < auth_tag_len_ || !Begin(ctx, message, false))
+    return false;
+
+  const size_t len = message.data_len - auth_tag_len_;
+  unsigned char* tag = const_cast<unsigned char*>(message.data + len);
+  if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, auth_tag_len_, tag))
+    return false;
+
+  int out_len;
+  return (len == 0 ||
+          EVP_CipherUpdate(ctx, out, &out_len, message.data, len) == 1) &&
+         EVP_CipherFinal_ex(ctx, out + len, &out_len) == 1;
+}
+
+AEADContext::AEADContext(Environment* env,
+                         Local<Object> wrap,
+                         std::shared_ptr<AEADKeySchedule> key_schedule)
+    : BaseObject(env, wrap), key_schedule_(std::move(key_schedule)) {
+  MakeWeak();
+}
+
+void AEADContext::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackFieldWithSize("key_schedule", kSizeOf_EVP_CIPHER_CTX);
+  tracker->TrackFieldWithSize("context", ctx_ ? kSizeOf_EVP_CIPHER_CTX : 0);
+}
+
+void AEADContext::Initialize(Environment* env, Local<Object> target) {
+  Isolate* isolate = env->isolate();
+  Local<Context> context = env->context();
+
+  Local<FunctionTemplate> t = NewFunctionTemplate(isolate, New);
+
+  t->InstanceTemplate()->SetInternalFieldCount(
+      AEADContext::kInternalFieldCount);
+  t->Inherit(BaseObject::GetConstructorTemplate(env));
+
+  SetProtoMethod(isolate, t, "seal", Seal);
+  SetProtoMethod(isolate, t, "open", Open);
+  SetConstructorFunction(context, target, "AEADContext", t);
+
+  AEADBatchJob::Initialize(env, target);
+}
+
+void AEADContext::RegisterExternalReferences(
+    ExternalReferenceRegistry* registry) {
+  registry->Register(New);
+  registry->Register(Seal);
+  registry->Register(Open);
+
+  AEADBatchJob::RegisterExternalReferences(registry);
+}
+
+// new AEADContext(cipher, key, authTagLength)
+void AEADContext::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  MarkPopErrorOnReturn mark_pop_error_on_return;
+
+  CHECK(args[0]->IsString());
+  const Utf8Value cipher_type(env->isolate(), args[0]);
+
+  // The key can either be a KeyObjectHandle or a byte source.
+  const ByteSource key_buf = ByteSource::FromSecretKeyBytes(env, args[1]);
+  if (UNLIKELY(key_buf.size() > INT_MAX))
+    return THROW_ERR_OUT_OF_RANGE(env, "key is too big");
+
+  const EVP_CIPHER* const cipher = GetCipherImplementation(*cipher_type);
+  if (cipher == nullptr)
+    return THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env);
+
+  const bool is_chacha20_poly1305 =
+      EVP_CIPHER_nid(cipher) == NID_chacha20_poly1305;
+  if (EVP_CIPHER_mode(cipher) != EVP_CIPH_GCM_MODE && !is_chacha20_poly1305) {
+    return THROW_ERR_CRYPTO_UNSUPPORTED_OPERATION(
+        env, "Unsupported AEAD cipher: %s", *cipher_type);
+  }
+
+  unsigned int auth_tag_len = EVP_GCM_TLS_TAG_LEN;
+  if (args[2]->IsUint32()) {
+    auth_tag_len = args[2].As<Uint32>()->Value();
+    const bool is_valid = is_chacha20_poly1305
+        ? auth_tag_len >= 1 && auth_tag_len <= EVP_GCM_TLS_TAG_LEN
+        : IsValidGCMTagLength(auth_tag_len);
+    if (!is_valid) {
+      return THROW_ERR_CRYPTO_INVALID_AUTH_TAG(
+          env, "Invalid authentication tag length: %u", auth_tag_len);
+    }
+  } else {
+    CHECK(args[2]->IsUndefined());
+  }
+
+  CipherCtxPointer ctx(EVP_CIPHER_CTX_new());
+  if (!ctx ||
+      !EVP_EncryptInit_ex(ctx.get(), cipher, nullptr, nullptr, nullptr)) {
+    return ThrowCryptoError(env, ERR_get_error(),
+                            "Failed to initialize cipher");
+  }
+
+  if (!EVP_CIPHER_CTX_set_key_length(ctx.get(), key_buf.size()))
+    return THROW_ERR_CRYPTO_INVALID_KEYLEN(env);
+
+  if (!EVP_EncryptInit_ex(ctx.get(), nullptr, nullptr,
+                          key_buf.data<unsigned char>(), nullptr)) {
+    return ThrowCryptoError(env, ERR_get_error(),
+                            "Failed to initialize cipher");
+  }
+
+  new AEADContext(
+      env,
+      args.This(),
+      std::make_shared<AEADKeySchedule>(std::move(ctx), auth_tag_len));
+}
+
+void AEADContext::Process(const FunctionCallbackInfo<Value>& args,
+                          bool encrypt) {
+  Environment* env = this->env();
+  MarkPopErrorOnReturn mark_pop_error_on_return;
+
+  ArrayBufferOrViewContents<unsigned char> iv(args[0]);
+  ArrayBufferOrViewContents<unsigned char> data(args[1]);
+  ArrayBufferOrViewContents<unsigned char> aad(args[2]);
+  if (UNLIKELY(!data.CheckSizeInt32()))
+    return THROW_ERR_OUT_OF_RANGE(env, "data is too big");
+  if (UNLIKELY(!aad.CheckSizeInt32()))
+    return THROW_ERR_OUT_OF_RANGE(env, "aad is too big");
+  if (!key_schedule_->IsValidIVLength(iv.size()))
+    return THROW_ERR_CRYPTO_INVALID_IV(env);
+
+  if (!ctx_) {
+    ctx_.reset(EVP_CIPHER_CTX_new());
+    if (!ctx_) {
+      return ThrowCryptoError(env, ERR_get_error(),
+                              "Failed to initialize cipher");
+    }
+  }
+
+  const size_t out_len =
+      GetAEADOutputLength(data.size(), key_schedule_->auth_tag_len(), encrypt);
+  std::unique_ptr<BackingStore> out;
+  {
+    NoArrayBufferZeroFillScope no_zero_fill_scope(env->isolate_data());
+    out = ArrayBuffer::NewBackingStore(env->isolate(), out_len);
+  }
+
+  const AEADMessage message {
+    iv.data(), iv.size(), aad.data(), aad.size(), data.data(), data.size()
+  };
+  unsigned char* dest = static_cast<unsigned char*>(out->Data());
+  if (encrypt) {
+    if (!key_schedule_->Seal(ctx_.get(), message, dest)) {
+      return ThrowCryptoError(env, ERR_get_error(),
+                              "Failed to encrypt message");
+    }
+  } else if (!key_schedule_->Open(ctx_.get(), message, dest)) {
+    OPENSSL_cleanse(dest, out_len);
+    return ThrowCryptoError(env, ERR_get_error(),
+                            "Unsupported state or unable to authenticate data");
+  }
+
+  Local<ArrayBuffer> ab = ArrayBuffer::New(env->isolate(), std::move(out));
+  args.GetReturnValue().Set(
+      Buffer::New(env, ab, 0, out_len).FromMaybe(Local<Value>()));
+}
+
+// context.seal(iv, data, aad)
+void AEADContext::Seal(const FunctionCallbackInfo<Value>& args) {
+  AEADContext* context;
+  ASSIGN_OR_RETURN_UNWRAP(&context, args.Holder());
+  context->Process(args, true);
+}
+
+// context.open(iv, data, aad)
+void AEADContext::Open(const FunctionCallbackInfo<Value>& args) {
+  AEADContext* context;
+  ASSIGN_OR_RETURN_UNWRAP(&context, args.Holder());
+  context->Process(args, false);
+}
+
+AEADBatchConfig::AEADBatchConfig(AEADBatchConfig&& other) noexcept
+    : mode(other.mode),
+      key_schedule(std::move(other.key_schedule)),
+      encrypt(other.encrypt),
+      data(std::move(other.data)),
+      data_offsets(std::move(other.data_offsets)),
+      iv(std::move(other.iv)),
+      iv_offsets(std::move(other.iv_offsets)),
+      aad(std::move(other.aad)),
+      aad_offsets(std::move(other.aad_offsets)) {}
+
+AEADBatchConfig& AEADBatchConfig::operator=(AEADBatchConfig&& other) noexcept {
+  if (&other == this) return *this;
+  this->~AEADBatchConfig();
+  return *new (this) AEADBatchConfig(std::move(other));
+}
+
+void AEADBatchConfig::MemoryInfo(MemoryTracker* tracker) const {
+  // If the Job is sync, then the AEADBatchConfig does not own the data.
+  if (mode == kCryptoJobAsync) {
+    tracker->TrackFieldWithSize("data", data.size());
+    tracker->TrackFieldWithSize("iv", iv.size());
+    tracker->TrackFieldWithSize("aad", aad.size());
+  }
+  tracker->TrackFieldWithSize(
+      "offsets",
+      (data_offsets.size() + iv_offsets.size() + aad_offsets.size()) *
+          sizeof(uint32_t));
+}
+
+// new AEADBatchJob(mode, context, encrypt, data, dataOffsets, iv, ivOffsets,
+//                  aad, aadOffsets)
+Maybe<bool> AEADBatchTraits::AdditionalConfig(
+    CryptoJobMode mode,
+    const FunctionCallbackInfo<Value>& args,
+    unsigned int offset,
+    AEADBatchConfig* params) {
+  Environment* env = Environment::GetCurrent(args);
+
+  params->mode = mode;
+
+  AEADContext* context;
+  CHECK(args[offset]->IsObject());
+  ASSIGN_OR_RETURN_UNWRAP(&context, args[offset], Nothing<bool>());
+  params->key_schedule = context->key_schedule();
+
+  CHECK(args[offset + 1]->IsBoolean());
+  params->encrypt = args[offset + 1]->IsTrue();
+
+  ArrayBufferOrViewContents<char> data(args[offset + 2]);
+  ArrayBufferOrViewContents<char> iv(args[offset + 4]);
+  ArrayBufferOrViewContents<char> aad(args[offset + 6]);
+  if (UNLIKELY(!data.CheckSizeInt32())) {
+    THROW_ERR_OUT_OF_RANGE(env, "data is too big");
+    return Nothing<bool>();
+  }
+  if (UNLIKELY(!aad.CheckSizeInt32())) {
+    THROW_ERR_OUT_OF_RANGE(env, "aad is too big");
+    return Nothing<bool>();
+  }
+
+  CopyBatchOffsets(args[offset + 3], data.size(), &params->data_offsets);
+  CopyBatchOffsets(args[offset + 5], iv.size(), &params->iv_offsets);
+  CopyBatchOffsets(args[offset + 7], aad.size(), &params->aad_offsets);
+  CHECK_EQ(params->iv_offsets.size(), params->data_offsets.size());
+  CHECK_EQ(params->aad_offsets.size(), params->data_offsets.size());
+
+  for (size_t i = 1; i < params->iv_offsets.size(); i++) {
+    const size_t iv_len = params->iv_offsets[i] - params->iv_offsets[i - 1];
+    if (!params->key_schedule->IsValidIVLength(iv_len)) {
+      THROW_ERR_CRYPTO_INVALID_IV(env);
+      return Nothing<bool>();
+    }
+  }
+
+  if (mode == kCryptoJobAsync) {
+    params->data = data.ToCopy();
+    params->iv = iv.ToCopy();
+    params->aad = aad.ToCopy();
+  } else {
+    params->data = data.ToByteSource();
+    params->iv = iv.ToByteSource();
+    params->aad = aad.ToByteSource();
+  }
+
+  return Just(true);
+}
+
+bool AEADBatchTraits::DeriveBits(
+    Environment* env,
+    const AEADBatchConfig& params,
+    ByteSource* out) {
+  // Messages that fail to authenticate leave errors on the queue, which must
+  // not be picked up by whichever job runs on this thread next.
+  ClearErrorOnReturn clear_error_on_return;
+
+  const size_t count = params.data_offsets.size() - 1;
+  if (count == 0) {
+    *out = ByteSource();
+    return true;
+  }
+
+  const AEADKeySchedule& key_schedule = *params.key_schedule;
+  const unsigned int auth_tag_len = key_schedule.auth_tag_len();
+  size_t total = count;
+  for (size_t i = 0; i < count; i++) {
+    total += GetAEADOutputLength(
+        params.data_offsets[i + 1] - params.data_offsets[i],
+        auth_tag_len,
+        params.encrypt);
+  }
+
+  CipherCtxPointer ctx(EVP_CIPHER_CTX_new());
+  if (UNLIKELY(!ctx)) return false;
+
+  ByteSource::Builder buf(total);
+  unsigned char* dest = buf.data<unsigned char>();
+  unsigned char* status = dest + total - count;
+  for (size_t i = 0; i < count; i++) {
+    const AEADMessage message = GetBatchMessage(params, i);
+    const size_t len =
+        GetAEADOutputLength(message.data_len, auth_tag_len, params.encrypt);
+    if (params.encrypt) {
+      // Sealing a message only fails because of internal errors.
+      if (!key_schedule.Seal(ctx.get(), message, dest))
+        return false;
+      status[i] = 1;
+    } else {
+      status[i] = key_schedule.Open(ctx.get(), message, dest);
+      if (!status[i])
+        OPENSSL_cleanse(dest, len);
+    }
+    dest += len;
+  }
+
+  *out = std::move(buf).release();
+  return true;
+}
+
+Maybe<bool> AEADBatchTraits::EncodeOutput(
+    Environment* env,
+    const AEADBatchConfig& params,
+    ByteSource* out,
+    v8::Local<v8::Value>* result) {
+  *result = out->ToArrayBuffer(env);
+  return Just(!result->IsEmpty());
+}
+
 }  // namespace crypto
 }  // namespace node
@@ -10,7 +10,9 @@
 #include "memory_tracker.h"
 #include "v8.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace node {
 namespace crypto {
@@ -94,6 +96,133 @@ class CipherBase : public BaseObject {
   int max_message_size_;
 };
 
+struct AEADMessage {
+  const unsigned char* iv;
+  size_t iv_len;
+  const unsigned char* aad;
+  size_t aad_len;
+  const unsigned char* data;
+  size_t data_len;
+};
+
+// A cipher context that has been initialized with an AEAD algorithm (AES-GCM
+// or ChaCha20-Poly1305) and a key, but no IV. Every message is processed on a
+// copy of it, so that the key schedule is only computed once per key. The
+// template itself is never modified and can be shared across threads.
+class AEADKeySchedule final {
+ public:
+  AEADKeySchedule(CipherCtxPointer&& ctx, unsigned int auth_tag_len);
+
+  unsigned int auth_tag_len() const { return auth_tag_len_; }
+  bool IsValidIVLength(size_t iv_len) const;
+
+  // Writes the ciphertext followed by the authentication tag to |out|, which
+  // must have room for data_len + auth_tag_len() bytes.
+  bool Seal(EVP_CIPHER_CTX* ctx,
+            const AEADMessage& message,
+            unsigned char* out) const;
+
+  // Verifies the authentication tag at the end of the data and writes the
+  // data_len - auth_tag_len() bytes of plaintext to |out|. Returns false if
+  // authentication fails.
+  bool Open(EVP_CIPHER_CTX* ctx,
+            const AEADMessage& message,
+            unsigned char* out) const;
+
+ private:
+  bool Begin(EVP_CIPHER_CTX* ctx,
+             const AEADMessage& message,
+             bool encrypt) const;
+
+  const CipherCtxPointer template_;
+  const unsigned int auth_tag_len_;
+  const bool is_chacha20_poly1305_;
+};
+
+class AEADContext final : public BaseObject {
+ public:
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+  static void RegisterExternalReferences(ExternalReferenceRegistry* registry);
+
+  const std::shared_ptr<AEADKeySchedule>& key_schedule() const {
+    return key_schedule_;
+  }
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(AEADContext)
+  SET_SELF_SIZE(AEADContext)
+
+ private:
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Seal(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Open(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  AEADContext(Environment* env,
+              v8::Local<v8::Object> wrap,
+              std::shared_ptr<AEADKeySchedule> key_schedule);
+
+  void Process(const v8::FunctionCallbackInfo<v8::Value>& args, bool encrypt);
+
+  std::shared_ptr<AEADKeySchedule> key_schedule_;
+  // Reused by the synchronous seal() and open() calls.
+  CipherCtxPointer ctx_;
+};
+
+// Seals or opens many messages with one AEADContext in a single call. The
+// data, IVs and additional authenticated data of the messages are each passed
+// as a single buffer plus an array of offsets delimiting the individual
+// messages.
+struct AEADBatchConfig final : public MemoryRetainer {
+  CryptoJobMode mode;
+  std::shared_ptr<AEADKeySchedule> key_schedule;
+  bool encrypt;
+  ByteSource data;
+  std::vector<uint32_t> data_offsets;
+  ByteSource iv;
+  std::vector<uint32_t> iv_offsets;
+  ByteSource aad;
+  std::vector<uint32_t> aad_offsets;
+
+  AEADBatchConfig() = default;
+
+  explicit AEADBatchConfig(AEADBatchConfig&& other) noexcept;
+
+  AEADBatchConfig& operator=(AEADBatchConfig&& other) noexcept;
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(AEADBatchConfig)
+  SET_SELF_SIZE(AEADBatchConfig)
+};
+
+struct AEADBatchTraits final {
+  using AdditionalParameters = AEADBatchConfig;
+  static constexpr const char* JobName = "AEADBatchJob";
+  static constexpr AsyncWrap::ProviderType Provider =
+      AsyncWrap::PROVIDER_CIPHERREQUEST;
+
+  static v8::Maybe<bool> AdditionalConfig(
+      CryptoJobMode mode,
+      const v8::FunctionCallbackInfo<v8::Value>& args,
+      unsigned int offset,
+      AEADBatchConfig* params);
+
+  // The output is the concatenation of the results of all messages, followed
+  // by one byte per message that is 1 if the message was processed and 0 if
+  // it failed to authenticate. The result of a failed message is zero-filled.
+  static bool DeriveBits(
+      Environment* env,
+      const AEADBatchConfig& params,
+      ByteSource* out);
+
+  static v8::Maybe<bool> EncodeOutput(
+      Environment* env,
+      const AEADBatchConfig& params,
+      ByteSource* out,
+      v8::Local<v8::Value>* result);
+};
+
+using AEADBatchJob = DeriveBitsJob<AEADBatchTraits>;
+
 class PublicKeyCipher {
  public:
   typedef int (*EVP_PKEY_cipher_init_t)(EVP_PKEY_CTX* ctx);
@@ -37,6 +37,7 @@ using v8::Just;
 using v8::Local;
 using v8::Maybe;
 using v8::Nothing;
+using v8::Number;
 using v8::Object;
 using v8::PropertyAttribute;
 using v8::ReadOnly;
@@ -49,6 +50,21 @@ static const char* const root_certs[] = {
 #include "node_root_certs.h"  // NOLINT(build/include_order)
 };
 
+// The same certificates as root_certs, DER encoded at build time by
+// tools/mkrootcertsder.py. The subject of each certificate is recorded so
+// that certificates can be found without decoding all of them.
+struct RootCertEntry {
+  size_t offset;
+  size_t length;
+  size_t subject_offset;
+  size_t subject_length;
+};
+
+#include "node_root_certs_der.h"  // NOLINT(build/include_order)
+
+static_assert(arraysize(root_cert_entries) == arraysize(root_certs),
+              "node_root_certs_der.h is out of date");
+
 static const char system_cert_path[] = NODE_OPENSSL_SYSTEM_CERT_PATH;
 
 static bool extra_root_certs_loaded = false;
@@ -196,28 +212,103 @@ int SSL_CTX_use_certificate_chain(SSL_CTX* ctx,
 
 }  // namespace
 
-X509_STORE* NewRootCertStore() {
-  static std::vector<X509*> root_certs_vector;
-  static Mutex root_certs_vector_mutex;
-  Mutex::ScopedLock lock(root_certs_vector_mutex);
-
-  if (root_certs_vector.empty() &&
-      per_process::cli_options->ssl_openssl_cert_store == false) {
-    for (size_t i = 0; i < arraysize(root_certs); i++) {
-      X509* x509 =
-          PEM_read_bio_X509(NodeBIO::NewFixed(root_certs[i],
-                                              strlen(root_certs[i])).get(),
-                            nullptr,   // no re-use of X509 structure
-                            NoPasswordCallback,
-                            nullptr);  // no callback data
+namespace {
+#if OPENSSL_VERSION_MAJOR >= 3
+using LookupName = const X509_NAME*;
+#else
+using LookupName = X509_NAME*;
+#endif
 
+// Adds the built-in root certificates with the subject |name| to |store|.
+// Decoding the certificates up front takes tens of milliseconds on slower
+// devices and keeps all of them in memory, while a typical process only ever
+// uses a handful, so this is done only once OpenSSL looks for them.
+bool AddRootCertsWithSubject(X509_STORE* store, LookupName name) {
+  using X509NamePointer = DeleteFnPtr<X509_NAME, X509_NAME_free>;
+  // Guaranteed thread-safe by standard, just don't use -fno-threadsafe-statics.
+  static const std::vector<X509NamePointer>* subjects = []() {
+    auto* subjects = new std::vector<X509NamePointer>();
+    subjects->reserve(arraysize(root_cert_entries));
+    for (const RootCertEntry& entry : root_cert_entries) {
+      const unsigned char* der = root_certs_der + entry.subject_offset;
+      subjects->emplace_back(
+          d2i_X509_NAME(nullptr, &der, entry.subject_length));
       // Parse errors from the built-in roots are fatal.
-      CHECK_NOT_NULL(x509);
-
-      root_certs_vector.push_back(x509);
+      CHECK(subjects->back());
     }
+    return subjects;
+  }();
+
+  bool found = false;
+  for (size_t i = 0; i < arraysize(root_cert_entries); i++) {
+    if (X509_NAME_cmp((*subjects)[i].get(), name) != 0)
+      continue;
+    const unsigned char* der = root_certs_der + root_cert_entries[i].offset;
+    X509Pointer x509(d2i_X509(nullptr, &der, root_cert_entries[i].length));
+    CHECK(x509);
+    // Adding a certificate that is already in the store is not an error.
+    X509_STORE_add_cert(store, x509.get());
+    found = true;
   }
+  return found;
+}
+
+// An X509_LOOKUP method that adds the built-in root certificates with a given
+// subject to the store when OpenSSL looks for them while building a chain.
+int LookupRootCertsBySubject(X509_LOOKUP* lookup,
+                             X509_LOOKUP_TYPE type,
+                             LookupName name,
+                             X509_OBJECT* ret) {
+  if (type != X509_LU_X509)
+    return 0;
 
+  X509_STORE* store = X509_LOOKUP_get_store(lookup);
+  if (!AddRootCertsWithSubject(store, name))
+    return 0;
+
+  // Return the certificate now cached in the store. |ret| does not own a
+  // reference, which matches what X509_STORE_CTX_get_by_subject() expects.
+  X509* cached = nullptr;
+  if (X509_STORE_lock(store)) {
+    X509_OBJECT* obj = X509_OBJECT_retrieve_by_subject(
+        X509_STORE_get0_objects(store), X509_LU_X509,
+        const_cast<X509_NAME*>(name));
+    if (obj != nullptr)
+      cached = X509_OBJECT_get0_X509(obj);
+    X509_STORE_unlock(store);
+  }
+  if (cached == nullptr || !X509_OBJECT_set1_X509(ret, cached))
+    return 0;
+  X509_free(cached);
+  return 1;
+}
+
+// OpenSSL only asks the lookup methods for a subject that is not in the store
+// yet. A certificate with the same subject that was added first, such as a
+// cross-signed root from NODE_EXTRA_CA_CERTS or the system certificates,
+// would hide the built-in root with that name, so the built-in roots are
+// also added before each search for an issuer.
+int GetIssuerWithRootCerts(X509** issuer, X509_STORE_CTX* ctx, X509* x) {
+  AddRootCertsWithSubject(X509_STORE_CTX_get0_store(ctx),
+                          X509_get_issuer_name(x));
+  return X509_STORE_CTX_get1_issuer(issuer, ctx, x);
+}
+
+X509_LOOKUP_METHOD* GetRootCertsLookupMethod() {
+  // Guaranteed thread-safe by standard, just don't use -fno-threadsafe-statics.
+  static X509_LOOKUP_METHOD* method = []() {
+    X509_LOOKUP_METHOD* method =
+        X509_LOOKUP_meth_new("Node.js built-in root certificates");
+    CHECK_NOT_NULL(method);
+    CHECK_EQ(1, X509_LOOKUP_meth_set_get_by_subject(
+                    method, LookupRootCertsBySubject));
+    return method;
+  }();
+  return method;
+}
+}  // namespace
+
+X509_STORE* NewRootCertStore() {
   X509_STORE* store = X509_STORE_new();
   if (*system_cert_path != '\0') {
     ERR_set_mark();
@@ -229,10 +320,8 @@ X509_STORE* NewRootCertStore() {
   if (per_process::cli_options->ssl_openssl_cert_store) {
     X509_STORE_set_default_paths(store);
   } else {
-    for (X509* cert : root_certs_vector) {
-      X509_up_ref(cert);
-      X509_STORE_add_cert(store, cert);
-    }
+    CHECK_NOT_NULL(X509_STORE_add_lookup(store, GetRootCertsLookupMethod()));
+    X509_STORE_set_get_issuer(store, GetIssuerWithRootCerts);
   }
 
   return store;
@@ -255,6 +344,113 @@ void GetRootCertificates(const FunctionCallbackInfo<Value>& args) {
       Array::New(env->isolate(), result, arraysize(root_certs)));
 }
 
+namespace {
+// Caches are kept alive by the SecureContexts that use them, and are released
+// once the last of those is gone.
+Mutex shared_session_caches_mutex;
+std::unordered_map<std::string, std::weak_ptr<SharedSessionCache>>*
+    shared_session_caches;
+}  // namespace
+
+std::shared_ptr<SharedSessionCache> SharedSessionCache::GetOrCreate(
+    const std::string& name) {
+  Mutex::ScopedLock lock(shared_session_caches_mutex);
+  if (shared_session_caches == nullptr) {
+    shared_session_caches = new std::unordered_map<
+        std::string, std::weak_ptr<SharedSessionCache>>();
+  }
+
+  std::weak_ptr<SharedSessionCache>& entry = (*shared_session_caches)[name];
+  std::shared_ptr<SharedSessionCache> cache = entry.lock();
+  if (cache) return cache;
+
+  cache = std::make_shared<SharedSessionCache>();
+  if (CSPRNG(cache->ticket_keys_, sizeof(cache->ticket_keys_)).is_err())
+    return nullptr;
+  entry = cache;
+  return cache;
+}
+
+std::shared_ptr<SharedSessionCache> SharedSessionCache::Find(
+    const std::string& name) {
+  Mutex::ScopedLock lock(shared_session_caches_mutex);
+  if (shared_session_caches == nullptr) return nullptr;
+  auto it = shared_session_caches->find(name);
+  if (it == shared_session_caches->end()) return nullptr;
+  return it->second.lock();
+}
+
+void SharedSessionCache::Add(SSL_SESSION* session) {
+  unsigned int id_length;
+  const unsigned char* id = SSL_SESSION_get_id(session, &id_length);
+  if (id_length == 0)
+    return;
+
+  int size = i2d_SSL_SESSION(session, nullptr);
+  if (size <= 0 || size > SecureContext::kMaxSessionSize)
+    return;
+  std::vector<unsigned char> data(size);
+  unsigned char* p = data.data();
+  CHECK_EQ(i2d_SSL_SESSION(session, &p), size);
+
+  std::string key(reinterpret_cast<const char*>(id), id_length);
+  Mutex::ScopedLock lock(mutex_);
+  auto result = sessions_.emplace(key, std::vector<unsigned char>());
+  result.first->second = std::move(data);
+  if (!result.second)
+    return;
+
+  insertion_order_.push_back(std::move(key));
+  while (insertion_order_.size() > kMaxEntries) {
+    sessions_.erase(insertion_order_.front());
+    insertion_order_.pop_front();
+  }
+}
+
+SSLSessionPointer SharedSessionCache::Lookup(const unsigned char* id,
+                                             size_t id_length) {
+  std::string key(reinterpret_cast<const char*>(id), id_length);
+  std::vector<unsigned char> data;
+  {
+    Mutex::ScopedLock lock(mutex_);
+    auto it = sessions_.find(key);
+    if (it == sessions_.end()) {
+      misses_++;
+      return SSLSessionPointer();
+    }
+    hits_++;
+    data = it->second;
+  }
+  // OpenSSL checks whether the session has expired or belongs to a different
+  // session id context before resuming it.
+  return GetTLSSession(data.data(), data.size());
+}
+
+SharedSessionCache::Stats SharedSessionCache::GetStats() {
+  Mutex::ScopedLock lock(mutex_);
+  return Stats { sessions_.size(), hits_, misses_ };
+}
+
+// getSharedSessionCacheStats(name)
+void GetSharedSessionCacheStats(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());
+  const Utf8Value name(env->isolate(), args[0]);
+
+  std::shared_ptr<SharedSessionCache> cache = SharedSessionCache::Find(*name);
+  if (!cache)
+    return;
+
+  SharedSessionCache::Stats stats = cache->GetStats();
+  Local<Value> result[] = {
+    Number::New(env->isolate(), static_cast<double>(stats.entries)),
+    Number::New(env->isolate(), static_cast<double>(stats.hits)),
+    Number::New(env->isolate(), static_cast<double>(stats.misses)),
+  };
+  args.GetReturnValue().Set(
+      Array::New(env->isolate(), result, arraysize(result)));
+}
+
 bool SecureContext::HasInstance(Environment* env, const Local<Value>& value) {
   return GetConstructorTemplate(env)->HasInstance(value);
 }
@@ -288,6 +484,14 @@ Local<FunctionTemplate> SecureContext::GetConstructorTemplate(
     SetProtoMethod(isolate, tmpl, "setOptions", SetOptions);
     SetProtoMethod(isolate, tmpl, "setSessionIdContext", SetSessionIdContext);
     SetProtoMethod(isolate, tmpl, "setSessionTimeout", SetSessionTimeout);
+    SetProtoMethod(
+        isolate, tmpl, "enableSharedSessionCache", EnableSharedSessionCache);
+    SetProtoMethod(
+        isolate, tmpl, "enablePrivateKeyOffload", EnablePrivateKeyOffload);
+    SetProtoMethodNoSideEffect(isolate,
+                               tmpl,
+                               "getPrivateKeyOffloadCount",
+                               GetPrivateKeyOffloadCount);
     SetProtoMethod(isolate, tmpl, "close", Close);
     SetProtoMethod(isolate, tmpl, "loadPKCS12", LoadPKCS12);
     SetProtoMethod(isolate, tmpl, "setTicketKeys", SetTicketKeys);
@@ -344,6 +548,10 @@ void SecureContext::Initialize(Environment* env, Local<Object> target) {
                         target,
                         "isExtraRootCertsFileLoaded",
                         IsExtraRootCertsFileLoaded);
+  SetMethodNoSideEffect(context,
+                        target,
+                        "getSharedSessionCacheStats",
+                        GetSharedSessionCacheStats);
 }
 
 void SecureContext::RegisterExternalReferences(
@@ -367,6 +575,9 @@ void SecureContext::RegisterExternalReferences(
   registry->Register(SetOptions);
   registry->Register(SetSessionIdContext);
   registry->Register(SetSessionTimeout);
+  registry->Register(EnableSharedSessionCache);
+  registry->Register(EnablePrivateKeyOffload);
+  registry->Register(GetPrivateKeyOffloadCount);
   registry->Register(Close);
   registry->Register(LoadPKCS12);
   registry->Register(SetTicketKeys);
@@ -383,6 +594,7 @@ void SecureContext::RegisterExternalReferences(
   registry->Register(CtxGetter);
 
   registry->Register(GetRootCertificates);
+  registry->Register(GetSharedSessionCacheStats);
   registry->Register(IsExtraRootCertsFileLoaded);
 }
 
@@ -410,6 +622,8 @@ inline void SecureContext::Reset() {
   ctx_.reset();
   cert_.reset();
   issuer_.reset();
+  shared_session_cache_.reset();
+  offload_keys_.clear();
 }
 
 SecureContext::~SecureContext() {
@@ -995,6 +1209,70 @@ void SecureContext::SetSessionTimeout(const FunctionCallbackInfo<Value>& args) {
   SSL_CTX_set_timeout(sc->ctx_.get(), sessionTimeout);
 }
 
+// enableSharedSessionCache(name)
+void SecureContext::EnableSharedSessionCache(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  Environment* env = sc->env();
+
+  CHECK_EQ(args.Length(), 1);
+  CHECK(args[0]->IsString());
+
+  const Utf8Value name(env->isolate(), args[0]);
+  std::shared_ptr<SharedSessionCache> cache =
+      SharedSessionCache::GetOrCreate(*name);
+  if (!cache) {
+    return THROW_ERR_CRYPTO_OPERATION_FAILED(
+        env, "Error generating ticket keys");
+  }
+
+  // Adopt the ticket keys of the cache, so that tickets issued by any of the
+  // SecureContexts that share it can be decrypted by all of them. Ticket keys
+  // that are set afterwards take precedence.
+  const unsigned char* keys = cache->ticket_keys();
+  memcpy(sc->ticket_key_name_, keys, 16);
+  memcpy(sc->ticket_key_hmac_, keys + 16, 16);
+  memcpy(sc->ticket_key_aes_, keys + 32, 16);
+
+  sc->shared_session_cache_ = std::move(cache);
+}
+
+void SecureContext::EnablePrivateKeyOffload(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  sc->private_key_offload_ = true;
+}
+
+// Used by tests to tell whether handshakes really went through the thread
+// pool, because they succeed either way.
+void SecureContext::GetPrivateKeyOffloadCount(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  args.GetReturnValue().Set(
+      static_cast<double>(sc->private_key_offload_count_));
+}
+
+EVP_PKEY* SecureContext::GetOffloadKey(EVP_PKEY* key) const {
+  for (const auto& entry : offload_keys_) {
+    if (entry.first.get() == key)
+      return entry.second.get();
+  }
+  return nullptr;
+}
+
+EVP_PKEY* SecureContext::AddOffloadKey(EVP_PKEY* key,
+                                       EVPKeyPointer&& offload_key) {
+  CHECK_NOT_NULL(offload_key);
+  // Keep a reference to the original key, so that its address cannot be
+  // reused by a different key while the entry exists.
+  CHECK_EQ(EVP_PKEY_up_ref(key), 1);
+  offload_keys_.emplace_back(EVPKeyPointer(key), std::move(offload_key));
+  return offload_keys_.back().second.get();
+}
+
 void SecureContext::Close(const FunctionCallbackInfo<Value>& args) {
   SecureContext* sc;
   ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
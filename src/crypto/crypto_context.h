@@ -8,8 +8,16 @@
 #include "crypto/crypto_util.h"
 #include "env.h"
 #include "memory_tracker.h"
+#include "node_mutex.h"
 #include "v8.h"
 
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace node {
 namespace crypto {
 // A maxVersion of 0 means "any", but OpenSSL may support TLS versions that
@@ -26,6 +34,48 @@ X509_STORE* NewRootCertStore();
 
 BIOPointer LoadBIO(Environment* env, v8::Local<v8::Value> v);
 
+// A store of serialized server-side TLS sessions that is shared by all
+// SecureContexts in the process that opt into it under the same name, so that
+// a session established on one thread can be resumed on another. It also
+// holds a set of ticket keys that those SecureContexts adopt, which makes
+// session tickets resumable across threads, too. Sessions are evicted in
+// insertion order once the store is full.
+class SharedSessionCache final {
+ public:
+  static constexpr size_t kMaxEntries = 20 * 1024;
+
+  struct Stats {
+    size_t entries;
+    uint64_t hits;
+    uint64_t misses;
+  };
+
+  // Returns the cache with the given name, creating it if necessary, or
+  // nullptr if the ticket keys for a new cache could not be generated.
+  static std::shared_ptr<SharedSessionCache> GetOrCreate(
+      const std::string& name);
+  // Returns nullptr if no SecureContext currently uses a cache of that name.
+  static std::shared_ptr<SharedSessionCache> Find(const std::string& name);
+
+  void Add(SSL_SESSION* session);
+  SSLSessionPointer Lookup(const unsigned char* id, size_t id_length);
+  Stats GetStats();
+
+  // 48 bytes, in the format accepted by SecureContext::SetTicketKeys().
+  const unsigned char* ticket_keys() const { return ticket_keys_; }
+
+ private:
+  Mutex mutex_;
+  std::unordered_map<std::string, std::vector<unsigned char>> sessions_;
+  std::deque<std::string> insertion_order_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  unsigned char ticket_keys_[48];
+};
+
+void GetSharedSessionCacheStats(
+    const v8::FunctionCallbackInfo<v8::Value>& args);
+
 class SecureContext final : public BaseObject {
  public:
   using GetSessionCb = SSL_SESSION* (*)(SSL*, const unsigned char*, int, int*);
@@ -56,8 +106,22 @@ class SecureContext final : public BaseObject {
   void SetSelectSNIContextCallback(SelectSNIContextCb cb);
 
   inline const X509Pointer& issuer() const { return issuer_; }
+  inline SharedSessionCache* shared_session_cache() const {
+    return shared_session_cache_.get();
+  }
   inline const X509Pointer& cert() const { return cert_; }
 
+  // Whether TLSWrap may run the private key operations of server handshakes
+  // that use this context on the thread pool.
+  inline bool private_key_offload() const { return private_key_offload_; }
+  // The copies of private keys that TLSWrap uses for that, keyed by the
+  // private key that was configured. Returns nullptr if there is none yet.
+  EVP_PKEY* GetOffloadKey(EVP_PKEY* key) const;
+  EVP_PKEY* AddOffloadKey(EVP_PKEY* key, EVPKeyPointer&& offload_key);
+  // Called by TLSWrap when a private key operation has completed on the
+  // thread pool.
+  inline void CountPrivateKeyOffload() { private_key_offload_count_++; }
+
   v8::Maybe<bool> AddCert(Environment* env, BIOPointer&& bio);
   v8::Maybe<bool> SetCRL(Environment* env, const BIOPointer& bio);
   v8::Maybe<bool> UseKey(Environment* env, std::shared_ptr<KeyObjectData> key);
@@ -103,6 +167,12 @@ class SecureContext final : public BaseObject {
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetSessionTimeout(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableSharedSessionCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnablePrivateKeyOffload(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetPrivateKeyOffloadCount(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetMinProto(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetMaxProto(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetMinProto(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -148,6 +218,12 @@ class SecureContext final : public BaseObject {
   EnginePointer private_key_engine_;
 #endif  // !OPENSSL_NO_ENGINE
 
+  std::shared_ptr<SharedSessionCache> shared_session_cache_;
+
+  bool private_key_offload_ = false;
+  uint64_t private_key_offload_count_ = 0;
+  std::vector<std::pair<EVPKeyPointer, EVPKeyPointer>> offload_keys_;
+
   unsigned char ticket_key_name_[16];
   unsigned char ticket_key_aes_[16];
   unsigned char ticket_key_hmac_[16];
@@ -67,8 +67,10 @@ void Hash::Initialize(Environment* env, Local<Object> target) {
   SetConstructorFunction(context, target, "Hash", t);
 
   SetMethodNoSideEffect(context, target, "getHashes", GetHashes);
+  SetMethodNoSideEffect(context, target, "oneShotDigest", OneShotDigest);
 
   HashJob::Initialize(env, target);
+  HashBatchJob::Initialize(env, target);
 
   SetMethodNoSideEffect(
       context, target, "internalVerifyIntegrity", InternalVerifyIntegrity);
@@ -79,12 +81,57 @@ void Hash::RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(HashUpdate);
   registry->Register(HashDigest);
   registry->Register(GetHashes);
+  registry->Register(OneShotDigest);
 
   HashJob::RegisterExternalReferences(registry);
+  HashBatchJob::RegisterExternalReferences(registry);
 
   registry->Register(InternalVerifyIntegrity);
 }
 
+// oneShotDigest(algorithm, input, outputEncoding)
+void Hash::OneShotDigest(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+  CHECK_EQ(args.Length(), 3);
+  CHECK(args[0]->IsString());
+  CHECK(args[1]->IsString() || args[1]->IsArrayBufferView());
+
+  const Utf8Value algorithm(isolate, args[0]);
+  const EVP_MD* md = GetDigestImplementation(*algorithm);
+  if (md == nullptr) {
+    return ThrowCryptoError(env, ERR_get_error(),
+                            "Digest method not supported");
+  }
+
+  enum encoding output_enc = ParseEncoding(isolate, args[2], HEX);
+
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size;
+  int ret;
+  if (args[1]->IsString()) {
+    Utf8Value input(isolate, args[1]);
+    ret = EVP_Digest(*input, input.length(), digest, &digest_size, md,
+                     nullptr);
+  } else {
+    ArrayBufferViewContents<unsigned char> input(args[1]);
+    ret = EVP_Digest(input.data(), input.length(), digest, &digest_size, md,
+                     nullptr);
+  }
+  if (ret != 1) return ThrowCryptoError(env, ERR_get_error());
+
+  Local<Value> error;
+  MaybeLocal<Value> rc = StringBytes::Encode(
+      isolate, reinterpret_cast<const char*>(digest), digest_size, output_enc,
+      &error);
+  if (rc.IsEmpty()) {
+    CHECK(!error.IsEmpty());
+    isolate->ThrowException(error);
+    return;
+  }
+  args.GetReturnValue().Set(rc.ToLocalChecked());
+}
+
 void Hash::New(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -96,7 +143,7 @@ void Hash::New(const FunctionCallbackInfo<Value>& args) {
     md = EVP_MD_CTX_md(orig->mdctx_.get());
   } else {
     const Utf8Value hash_type(env->isolate(), args[0]);
-    md = EVP_get_digestbyname(*hash_type);
+    md = GetDigestImplementation(*hash_type);
   }
 
   Maybe<unsigned int> xof_md_len = Nothing<unsigned int>();
@@ -249,7 +296,7 @@ Maybe<bool> HashTraits::AdditionalConfig(
 
   CHECK(args[offset]->IsString());  // Hash algorithm
   Utf8Value digest(env->isolate(), args[offset]);
-  params->digest = EVP_get_digestbyname(*digest);
+  params->digest = GetDigestImplementation(*digest);
   if (UNLIKELY(params->digest == nullptr)) {
     THROW_ERR_CRYPTO_INVALID_DIGEST(env, "Invalid digest: %s", *digest);
     return Nothing<bool>();
@@ -315,6 +362,112 @@ bool HashTraits::DeriveBits(
   return true;
 }
 
+HashBatchConfig::HashBatchConfig(HashBatchConfig&& other) noexcept
+    : mode(other.mode),
+      in(std::move(other.in)),
+      offsets(std::move(other.offsets)),
+      digest(other.digest) {}
+
+HashBatchConfig& HashBatchConfig::operator=(HashBatchConfig&& other) noexcept {
+  if (&other == this) return *this;
+  this->~HashBatchConfig();
+  return *new (this) HashBatchConfig(std::move(other));
+}
+
+void HashBatchConfig::MemoryInfo(MemoryTracker* tracker) const {
+  // If the Job is sync, then the HashBatchConfig does not own the data.
+  if (mode == kCryptoJobAsync)
+    tracker->TrackFieldWithSize("in", in.size());
+  tracker->TrackFieldWithSize("offsets", offsets.size() * sizeof(uint32_t));
+}
+
+Maybe<bool> HashBatchTraits::EncodeOutput(
+    Environment* env,
+    const HashBatchConfig& params,
+    ByteSource* out,
+    v8::Local<v8::Value>* result) {
+  *result = out->ToArrayBuffer(env);
+  return Just(!result->IsEmpty());
+}
+
+// new HashBatchJob(mode, algorithm, data, offsets)
+Maybe<bool> HashBatchTraits::AdditionalConfig(
+    CryptoJobMode mode,
+    const FunctionCallbackInfo<Value>& args,
+    unsigned int offset,
+    HashBatchConfig* params) {
+  Environment* env = Environment::GetCurrent(args);
+
+  params->mode = mode;
+
+  CHECK(args[offset]->IsString());  // Hash algorithm
+  Utf8Value digest(env->isolate(), args[offset]);
+  params->digest = GetDigestImplementation(*digest);
+  if (UNLIKELY(params->digest == nullptr)) {
+    THROW_ERR_CRYPTO_INVALID_DIGEST(env, "Invalid digest: %s", *digest);
+    return Nothing<bool>();
+  }
+
+  ArrayBufferOrViewContents<char> data(args[offset + 1]);
+  if (UNLIKELY(!data.CheckSizeInt32())) {
+    THROW_ERR_OUT_OF_RANGE(env, "data is too big");
+    return Nothing<bool>();
+  }
+
+  // The offsets are validated in JS land: there is one more offset than there
+  // are inputs, they do not decrease, and the last one is within bounds.
+  CHECK(args[offset + 2]->IsUint32Array());
+  ArrayBufferViewContents<char> offsets(args[offset + 2]);
+  size_t offset_count = offsets.length() / sizeof(uint32_t);
+  CHECK_GE(offset_count, 1);
+  params->offsets.resize(offset_count);
+  memcpy(params->offsets.data(), offsets.data(), offsets.length());
+  for (size_t i = 1; i < params->offsets.size(); i++)
+    CHECK_LE(params->offsets[i - 1], params->offsets[i]);
+  CHECK_LE(params->offsets.back(), data.size());
+
+  params->in = mode == kCryptoJobAsync
+      ? data.ToCopy()
+      : data.ToByteSource();
+
+  return Just(true);
+}
+
+bool HashBatchTraits::DeriveBits(
+    Environment* env,
+    const HashBatchConfig& params,
+    ByteSource* out) {
+  size_t count = params.offsets.size() - 1;
+  unsigned int length = EVP_MD_size(params.digest);
+  if (count == 0 || length == 0) {
+    *out = ByteSource();
+    return true;
+  }
+
+  EVPMDPointer ctx(EVP_MD_CTX_new());
+  if (UNLIKELY(!ctx)) return false;
+
+  ByteSource::Builder buf(count * length);
+  unsigned char* dest = buf.data<unsigned char>();
+  const char* in = params.in.data<char>();
+  for (size_t i = 0; i < count; i++) {
+    unsigned int written = length;
+    if (UNLIKELY(EVP_DigestInit_ex(ctx.get(), params.digest, nullptr) <= 0 ||
+                 EVP_DigestUpdate(ctx.get(),
+                                  in + params.offsets[i],
+                                  params.offsets[i + 1] -
+                                      params.offsets[i]) <= 0 ||
+                 EVP_DigestFinal_ex(ctx.get(), dest, &written) <= 0)) {
+      return false;
+    }
+    CHECK_EQ(written, length);
+    dest += length;
+  }
+
+  *out = std::move(buf).release();
+  return true;
+}
+
 void InternalVerifyIntegrity(const v8::FunctionCallbackInfo<v8::Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -329,7 +482,7 @@ void InternalVerifyIntegrity(const v8::FunctionCallbackInfo<v8::Value>& args) {
   CHECK(args[2]->IsArrayBufferView());
   ArrayBufferOrViewContents<unsigned char> expected(args[2]);
 
-  const EVP_MD* md_type = EVP_get_digestbyname(*algorithm);
+  const EVP_MD* md_type = GetDigestImplementation(*algorithm);
   unsigned char digest[EVP_MAX_MD_SIZE];
   unsigned int digest_size;
   if (md_type == nullptr || EVP_Digest(content.data(),
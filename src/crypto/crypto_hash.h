@@ -25,6 +25,7 @@ class Hash final : public BaseObject {
   bool HashUpdate(const char* data, size_t len);
 
   static void GetHashes(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void OneShotDigest(const v8::FunctionCallbackInfo<v8::Value>& args);
 
  protected:
   static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -82,6 +83,51 @@ struct HashTraits final {
 
 using HashJob = DeriveBitsJob<HashTraits>;
 
+// Computes the digests of many inputs, which are passed as a single buffer
+// plus an array of offsets delimiting the individual inputs, in one call.
+struct HashBatchConfig final : public MemoryRetainer {
+  CryptoJobMode mode;
+  ByteSource in;
+  std::vector<uint32_t> offsets;
+  const EVP_MD* digest;
+
+  HashBatchConfig() = default;
+
+  explicit HashBatchConfig(HashBatchConfig&& other) noexcept;
+
+  HashBatchConfig& operator=(HashBatchConfig&& other) noexcept;
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(HashBatchConfig)
+  SET_SELF_SIZE(HashBatchConfig)
+};
+
+struct HashBatchTraits final {
+  using AdditionalParameters = HashBatchConfig;
+  static constexpr const char* JobName = "HashBatchJob";
+  static constexpr AsyncWrap::ProviderType Provider =
+      AsyncWrap::PROVIDER_HASHREQUEST;
+
+  static v8::Maybe<bool> AdditionalConfig(
+      CryptoJobMode mode,
+      const v8::FunctionCallbackInfo<v8::Value>& args,
+      unsigned int offset,
+      HashBatchConfig* params);
+
+  static bool DeriveBits(
+      Environment* env,
+      const HashBatchConfig& params,
+      ByteSource* out);
+
+  static v8::Maybe<bool> EncodeOutput(
+      Environment* env,
+      const HashBatchConfig& params,
+      ByteSource* out,
+      v8::Local<v8::Value>* result);
+};
+
+using HashBatchJob = DeriveBitsJob<HashBatchTraits>;
+
 void InternalVerifyIntegrity(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 }  // namespace crypto
@@ -16,6 +16,10 @@
 #include "util-inl.h"
 #include "v8.h"
 
+#include <list>
+#include <string>
+#include <unordered_map>
+
 namespace node {
 
 using v8::Array;
@@ -553,6 +557,144 @@ Maybe<bool> GetAsymmetricKeyDetail(
   THROW_ERR_CRYPTO_INVALID_KEYTYPE(env);
   return Nothing<bool>();
 }
+
+// Parses a key that may be either a public or a private key.
+ParseKeyResult ParsePublicOrPrivateKey(EVPKeyPointer* pkey,
+                                       const PrivateKeyEncodingConfig& config,
+                                       const char* data,
+                                       size_t size) {
+  if (config.format_ == kKeyFormatPEM) {
+    // For PEM, we can easily determine whether it is a public or private key
+    // by looking for the respective PEM tags.
+    ParseKeyResult ret = ParsePublicKeyPEM(pkey, data, size);
+    if (ret == ParseKeyResult::kParseKeyNotRecognized)
+      ret = ParsePrivateKey(pkey, config, data, size);
+    return ret;
+  }
+
+  // For DER, the type determines how to parse it. SPKI, PKCS#8 and SEC1 are
+  // easy, but PKCS#1 can be a public key or a private key.
+  bool is_public;
+  switch (config.type_.ToChecked()) {
+    case kKeyEncodingPKCS1:
+      is_public = !IsRSAPrivateKey(
+          reinterpret_cast<const unsigned char*>(data), size);
+      break;
+    case kKeyEncodingSPKI:
+      is_public = true;
+      break;
+    case kKeyEncodingPKCS8:
+    case kKeyEncodingSEC1:
+      is_public = false;
+      break;
+    default:
+      UNREACHABLE("Invalid key encoding type");
+  }
+
+  if (is_public)
+    return ParsePublicKey(pkey, config, data, size);
+  return ParsePrivateKey(pkey, config, data, size);
+}
+
+// Parsing PEM and DER keys is expensive, and applications that verify JWTs or
+// sign responses tend to pass the same key material over and over again.
+// Keys that were parsed without a passphrase are therefore kept in a small,
+// process-wide LRU cache, so that repeated calls share one EVP_PKEY. The cache
+// is keyed by a SHA-256 digest of the input, so that it does not hold on to
+// copies of the key material. Like KeyObjectData, the keys are safe to share
+// among threads.
+class ParsedKeyCache final {
+ public:
+  static constexpr size_t kMaxEntries = 128;
+  // Larger inputs are unlikely to be keys and are never cached.
+  static constexpr size_t kMaxInputLength = 16 * 1024;
+
+  static ParsedKeyCache* GetInstance() {
+    // Intentionally leaked, so that it can be used until the process exits.
+    static ParsedKeyCache* cache = new ParsedKeyCache();
+    return cache;
+  }
+
+  // Returns the cache key for a key that is parsed with the given
+  // configuration, or an empty string if it must not be cached. |kind|
+  // distinguishes the parsers that are used for the same input.
+  static std::string GetId(char kind,
+                           const PrivateKeyEncodingConfig& config,
+                           const char* data,
+                           size_t size) {
+    if (!config.passphrase_.IsEmpty() || size > kMaxInputLength)
+      return std::string();
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_length;
+    if (!EVP_Digest(data, size, digest, &digest_length, EVP_sha256(), nullptr))
+      return std::string();
+    const uint32_t generation = GetFipsGeneration();
+    std::string id;
+    id.reserve(3 + sizeof(generation) + digest_length);
+    id += kind;
+    id += static_cast<char>(config.format_);
+    id += static_cast<char>(config.type_.IsJust() ? config.type_.FromJust()
+                                                  : -1);
+    id.append(reinterpret_cast<const char*>(&generation), sizeof(generation));
+    id.append(reinterpret_cast<const char*>(digest), digest_length);
+    return id;
+  }
+
+  ManagedEVPPKey Find(const std::string& id) {
+    Mutex::ScopedLock lock(mutex_);
+    auto it = index_.find(id);
+    if (it == index_.end())
+      return ManagedEVPPKey();
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  void Add(const std::string& id, const ManagedEVPPKey& key) {
+    Mutex::ScopedLock lock(mutex_);
+    if (index_.count(id) > 0)
+      return;
+    entries_.emplace_front(id, key);
+    index_.emplace(id, entries_.begin());
+    if (entries_.size() > kMaxEntries) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  using Entry = std::pair<std::string, ManagedEVPPKey>;
+
+  Mutex mutex_;
+  // Most recently used first.
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
+// Parses a key with |parse| unless it is found in the ParsedKeyCache.
+template <typename Parse>
+ManagedEVPPKey GetCachedOrParsedKey(Environment* env,
+                                    char kind,
+                                    const PrivateKeyEncodingConfig& config,
+                                    const char* data,
+                                    size_t size,
+                                    const char* default_msg,
+                                    Parse&& parse) {
+  ParsedKeyCache* cache = ParsedKeyCache::GetInstance();
+  const std::string id = ParsedKeyCache::GetId(kind, config, data, size);
+  if (!id.empty()) {
+    ManagedEVPPKey key = cache->Find(id);
+    if (key)
+      return key;
+  }
+
+  EVPKeyPointer pkey;
+  ParseKeyResult ret = parse(&pkey);
+  ManagedEVPPKey key =
+      ManagedEVPPKey::GetParsedKey(env, std::move(pkey), ret, default_msg);
+  if (key && !id.empty())
+    cache->Add(id, key);
+  return key;
+}
 }  // namespace
 
 ManagedEVPPKey::ManagedEVPPKey(EVPKeyPointer&& pkey) : pkey_(std::move(pkey)),
@@ -686,7 +828,7 @@ ManagedEVPPKey::GetPrivateKeyEncodingFromJs(
     if (context != kKeyContextInput) {
       if (args[*offset]->IsString()) {
         Utf8Value cipher_name(env->isolate(), args[*offset]);
-        result.cipher_ = EVP_get_cipherbyname(*cipher_name);
+        result.cipher_ = GetCipherImplementation(*cipher_name);
         if (result.cipher_ == nullptr) {
           THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env);
           return NonCopyableMaybe<PrivateKeyEncodingConfig>();
@@ -738,11 +880,14 @@ ManagedEVPPKey ManagedEVPPKey::GetPrivateKeyFromJs(
     if (config.IsEmpty())
       return ManagedEVPPKey();
 
-    EVPKeyPointer pkey;
-    ParseKeyResult ret =
-        ParsePrivateKey(&pkey, config.Release(), key.data<char>(), key.size());
-    return GetParsedKey(env, std::move(pkey), ret,
-                        "Failed to read private key");
+    const PrivateKeyEncodingConfig private_config = config.Release();
+    auto parse = [&](EVPKeyPointer* pkey) {
+      return ParsePrivateKey(
+          pkey, private_config, key.data<char>(), key.size());
+    };
+    return GetCachedOrParsedKey(env, 'p', private_config, key.data<char>(),
+                                key.size(), "Failed to read private key",
+                                parse);
   } else {
     CHECK(args[*offset]->IsObject() && allow_key_object);
     KeyObjectHandle* key;
@@ -768,45 +913,12 @@ ManagedEVPPKey ManagedEVPPKey::GetPublicOrPrivateKeyFromJs(
     if (config_.IsEmpty())
       return ManagedEVPPKey();
 
-    ParseKeyResult ret;
-    PrivateKeyEncodingConfig config = config_.Release();
-    EVPKeyPointer pkey;
-    if (config.format_ == kKeyFormatPEM) {
-      // For PEM, we can easily determine whether it is a public or private key
-      // by looking for the respective PEM tags.
-      ret = ParsePublicKeyPEM(&pkey, data.data(), data.size());
-      if (ret == ParseKeyResult::kParseKeyNotRecognized) {
-        ret = ParsePrivateKey(&pkey, config, data.data(), data.size());
-      }
-    } else {
-      // For DER, the type determines how to parse it. SPKI, PKCS#8 and SEC1 are
-      // easy, but PKCS#1 can be a public key or a private key.
-      bool is_public;
-      switch (config.type_.ToChecked()) {
-        case kKeyEncodingPKCS1:
-          is_public = !IsRSAPrivateKey(
-              reinterpret_cast<const unsigned char*>(data.data()), data.size());
-          break;
-        case kKeyEncodingSPKI:
-          is_public = true;
-          break;
-        case kKeyEncodingPKCS8:
-        case kKeyEncodingSEC1:
-          is_public = false;
-          break;
-        default:
-          UNREACHABLE("Invalid key encoding type");
-      }
-
-      if (is_public) {
-        ret = ParsePublicKey(&pkey, config, data.data(), data.size());
-      } else {
-        ret = ParsePrivateKey(&pkey, config, data.data(), data.size());
-      }
-    }
-
-    return ManagedEVPPKey::GetParsedKey(
-        env, std::move(pkey), ret, "Failed to read asymmetric key");
+    const PrivateKeyEncodingConfig config = config_.Release();
+    auto parse = [&](EVPKeyPointer* pkey) {
+      return ParsePublicOrPrivateKey(pkey, config, data.data(), data.size());
+    };
+    return GetCachedOrParsedKey(env, 'a', config, data.data(), data.size(),
+                                "Failed to read asymmetric key", parse);
   } else {
     CHECK(args[*offset]->IsObject());
     KeyObjectHandle* key = Unwrap<KeyObjectHandle>(args[*offset].As<Object>());
@@ -7,13 +7,17 @@
 #include "v8.h"
 
 #include <openssl/bn.h>
+#include <openssl/crypto.h>
 #include <openssl/rand.h>
 
+#include <memory>
+
 namespace node {
 
 using v8::ArrayBuffer;
 using v8::BackingStore;
 using v8::Boolean;
+using v8::Context;
 using v8::FunctionCallbackInfo;
 using v8::Int32;
 using v8::Just;
@@ -222,14 +226,76 @@ Maybe<bool> CheckPrimeTraits::EncodeOutput(
   return Just(true);
 }
 
+namespace {
+// Small requests for random data are served from a per-thread buffer that is
+// refilled in bulk, so that they neither create a RandomBytesJob nor call into
+// OpenSSL's DRBG every time. Bytes are wiped from the buffer as they are handed
+// out, so that they are never returned twice and do not linger in memory.
+constexpr size_t kRandomPoolSize = 4096;
+
+struct RandomPool {
+  unsigned char data[kRandomPoolSize];
+  size_t remaining = 0;
+
+  static void Free(RandomPool* pool) {
+    // OPENSSL_secure_clear_free() falls back to OPENSSL_clear_free() for
+    // memory that was not allocated from the secure heap.
+    OPENSSL_secure_clear_free(pool, sizeof(*pool));
+  }
+};
+
+thread_local DeleteFnPtr<RandomPool, RandomPool::Free> random_pool;
+
+// fillRandomFromPool(buffer, offset, size)
+// Returns false if the CSPRNG failed, in which case the caller should fall
+// back to a RandomBytesJob to obtain the error.
+void FillRandomFromPool(const FunctionCallbackInfo<Value>& args) {
+  CHECK(IsAnyByteSource(args[0]));
+  CHECK(args[1]->IsUint32());
+  CHECK(args[2]->IsUint32());
+
+  ArrayBufferOrViewContents<unsigned char> buffer(args[0]);
+  const uint32_t offset = args[1].As<Uint32>()->Value();
+  const uint32_t size = args[2].As<Uint32>()->Value();
+  CHECK_LE(size, kRandomPoolSize);
+  CHECK_GE(offset + size, offset);  // Overflow check.
+  CHECK_LE(offset + size, buffer.size());  // Bounds check.
+
+  if (!random_pool) {
+    // Use the secure heap if one was configured with --secure-heap.
+    random_pool.reset(static_cast<RandomPool*>(
+        OPENSSL_secure_zalloc(sizeof(RandomPool))));
+    if (!random_pool)
+      return args.GetReturnValue().Set(false);
+  }
+
+  RandomPool* pool = random_pool.get();
+  if (pool->remaining < size) {
+    if (CSPRNG(pool->data, kRandomPoolSize).is_err())
+      return args.GetReturnValue().Set(false);
+    pool->remaining = kRandomPoolSize;
+  }
+
+  unsigned char* data = pool->data + pool->remaining - size;
+  memcpy(buffer.data() + offset, data, size);
+  OPENSSL_cleanse(data, size);
+  pool->remaining -= size;
+  args.GetReturnValue().Set(true);
+}
+}  // namespace
+
 namespace Random {
 void Initialize(Environment* env, Local<Object> target) {
+  Local<Context> context = env->context();
   RandomBytesJob::Initialize(env, target);
   RandomPrimeJob::Initialize(env, target);
   CheckPrimeJob::Initialize(env, target);
+
+  SetMethod(context, target, "fillRandomFromPool", FillRandomFromPool);
 }
 
 void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
+  registry->Register(FillRandomFromPool);
   RandomBytesJob::RegisterExternalReferences(registry);
   RandomPrimeJob::RegisterExternalReferences(registry);
   CheckPrimeJob::RegisterExternalReferences(registry);
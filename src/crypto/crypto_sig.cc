@@ -294,7 +294,7 @@ SignBase::Error SignBase::Init(const char* sign_type) {
       strcmp(sign_type, "DSS1") == 0) {
     sign_type = "SHA1";
   }
-  const EVP_MD* md = EVP_get_digestbyname(sign_type);
+  const EVP_MD* md = GetDigestImplementation(sign_type);
   if (md == nullptr)
     return kSignUnknownDigest;
 
@@ -341,6 +341,7 @@ void Sign::Initialize(Environment* env, Local<Object> target) {
   SetConstructorFunction(env->context(), target, "Sign", t);
 
   SignJob::Initialize(env, target);
+  SignBatchJob::Initialize(env, target);
 
   constexpr int kSignJobModeSign = SignConfiguration::kSign;
   constexpr int kSignJobModeVerify = SignConfiguration::kVerify;
@@ -358,6 +359,7 @@ void Sign::RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(SignUpdate);
   registry->Register(SignFinal);
   SignJob::RegisterExternalReferences(registry);
+  SignBatchJob::RegisterExternalReferences(registry);
 }
 
 void Sign::New(const FunctionCallbackInfo<Value>& args) {
@@ -646,7 +648,7 @@ Maybe<bool> SignTraits::AdditionalConfig(
 
   if (args[offset + 6]->IsString()) {
     Utf8Value digest(env->isolate(), args[offset + 6]);
-    params->digest = EVP_get_digestbyname(*digest);
+    params->digest = GetDigestImplementation(*digest);
     if (params->digest == nullptr) {
       THROW_ERR_CRYPTO_INVALID_DIGEST(env, "Invalid digest: %s", *digest);
       return Nothing<bool>();
@@ -829,5 +831,165 @@ Maybe<bool> SignTraits::EncodeOutput(
   return Just(!result->IsEmpty());
 }
 
+SignBatchConfiguration::SignBatchConfiguration(
+    SignBatchConfiguration&& other) noexcept
+    : base(std::move(other.base)),
+      data_offsets(std::move(other.data_offsets)),
+      signatures(std::move(other.signatures)) {}
+
+SignBatchConfiguration& SignBatchConfiguration::operator=(
+    SignBatchConfiguration&& other) noexcept {
+  if (&other == this) return *this;
+  this->~SignBatchConfiguration();
+  return *new (this) SignBatchConfiguration(std::move(other));
+}
+
+void SignBatchConfiguration::MemoryInfo(MemoryTracker* tracker) const {
+  tracker->TrackField("base", base);
+  tracker->TrackFieldWithSize("data_offsets",
+                              data_offsets.size() * sizeof(uint32_t));
+  if (base.job_mode == kCryptoJobAsync) {
+    size_t signatures_size = 0;
+    for (const ByteSource& signature : signatures)
+      signatures_size += signature.size();
+    tracker->TrackFieldWithSize("signatures", signatures_size);
+  }
+}
+
+// The arguments are the same as those of SignJob, followed by:
+//   [offset + 11] the offsets delimiting the inputs in the data buffer,
+//   [offset + 12] the packed signatures, or undefined when signing,
+//   [offset + 13] the offsets delimiting the signatures, or undefined.
+// The offsets are validated in JS land: there is one more offset than there
+// are items, they do not decrease, and the last one is within bounds.
+Maybe<bool> SignBatchTraits::AdditionalConfig(
+    CryptoJobMode mode,
+    const FunctionCallbackInfo<Value>& args,
+    unsigned int offset,
+    SignBatchConfiguration* params) {
+  if (SignTraits::AdditionalConfig(mode, args, offset, &params->base)
+          .IsNothing()) {
+    return Nothing<bool>();
+  }
+
+  CHECK(args[offset + 11]->IsUint32Array());
+  ArrayBufferViewContents<char> data_offsets(args[offset + 11]);
+  size_t count = data_offsets.length() / sizeof(uint32_t);
+  CHECK_GE(count, 1);
+  params->data_offsets.resize(count);
+  memcpy(params->data_offsets.data(),
+         data_offsets.data(),
+         data_offsets.length());
+  for (size_t i = 1; i < count; i++)
+    CHECK_LE(params->data_offsets[i - 1], params->data_offsets[i]);
+  CHECK_LE(params->data_offsets.back(), params->base.data.size());
+
+  if (params->base.mode != SignConfiguration::kVerify)
+    return Just(true);
+
+  ArrayBufferOrViewContents<char> signatures(args[offset + 12]);
+  CHECK(args[offset + 13]->IsUint32Array());
+  ArrayBufferViewContents<char> signature_offsets_contents(args[offset + 13]);
+  CHECK_EQ(signature_offsets_contents.length(), data_offsets.length());
+  std::vector<uint32_t> signature_offsets(count);
+  memcpy(signature_offsets.data(),
+         signature_offsets_contents.data(),
+         signature_offsets_contents.length());
+  CHECK_LE(signature_offsets.back(), signatures.size());
+
+  // Signatures in the IEEE-P1363 format are converted to DER, which is what
+  // OpenSSL expects, once here rather than on the thread pool.
+  const ManagedEVPPKey& key = params->base.key;
+  Mutex::ScopedLock lock(*key.mutex());
+  bool use_p1363 = UseP1363Encoding(key, params->base.dsa_encoding);
+  params->signatures.reserve(count - 1);
+  for (size_t i = 0; i + 1 < count; i++) {
+    CHECK_LE(signature_offsets[i], signature_offsets[i + 1]);
+    const char* start = signatures.data() + signature_offsets[i];
+    size_t length = signature_offsets[i + 1] - signature_offsets[i];
+    if (use_p1363) {
+      params->signatures.push_back(
+          ConvertSignatureToDER(key, ByteSource::Foreign(start, length)));
+    } else if (mode == kCryptoJobAsync) {
+      ByteSource::Builder copy(length);
+      memcpy(copy.data<char>(), start, length);
+      params->signatures.push_back(std::move(copy).release());
+    } else {
+      params->signatures.push_back(ByteSource::Foreign(start, length));
+    }
+  }
+
+  return Just(true);
+}
+
+// When signing, the output starts with one more uint32_t offset than there are
+// inputs, delimiting the signatures that follow. When verifying, the output is
+// one byte per input that is 1 if the signature is valid, and 0 otherwise.
+bool SignBatchTraits::DeriveBits(
+    Environment* env,
+    const SignBatchConfiguration& params,
+    ByteSource* out) {
+  size_t count = params.data_offsets.size() - 1;
+
+  SignConfiguration item;
+  item.job_mode = params.base.job_mode;
+  item.mode = params.base.mode;
+  item.key = params.base.key;
+  item.digest = params.base.digest;
+  item.flags = params.base.flags;
+  item.padding = params.base.padding;
+  item.salt_length = params.base.salt_length;
+  item.dsa_encoding = params.base.dsa_encoding;
+
+  const char* data = params.base.data.data<char>();
+  std::vector<ByteSource> results(count);
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    item.data = ByteSource::Foreign(
+        data + params.data_offsets[i],
+        params.data_offsets[i + 1] - params.data_offsets[i]);
+    if (item.mode == SignConfiguration::kVerify) {
+      const ByteSource& signature = params.signatures[i];
+      item.signature = ByteSource::Foreign(signature.data(), signature.size());
+    }
+    if (!SignTraits::DeriveBits(env, item, &results[i]))
+      return false;
+    total += results[i].size();
+  }
+
+  if (item.mode == SignConfiguration::kVerify) {
+    ByteSource::Builder buf(count);
+    for (size_t i = 0; i < count; i++)
+      buf.data<char>()[i] = results[i].data<char>()[0];
+    *out = std::move(buf).release();
+    return true;
+  }
+
+  size_t header_size = (count + 1) * sizeof(uint32_t);
+  if (UNLIKELY(total > std::numeric_limits<uint32_t>::max() - header_size))
+    return false;
+  ByteSource::Builder buf(header_size + total);
+  uint32_t* offsets = buf.data<uint32_t>();
+  char* dest = buf.data<char>() + header_size;
+  offsets[0] = 0;
+  for (size_t i = 0; i < count; i++) {
+    const ByteSource& signature = results[i];
+    if (signature.size() > 0)
+      memcpy(dest + offsets[i], signature.data(), signature.size());
+    offsets[i + 1] = offsets[i] + signature.size();
+  }
+  *out = std::move(buf).release();
+  return true;
+}
+
+Maybe<bool> SignBatchTraits::EncodeOutput(
+    Environment* env,
+    const SignBatchConfiguration& params,
+    ByteSource* out,
+    Local<Value>* result) {
+  *result = out->ToArrayBuffer(env);
+  return Just(!result->IsEmpty());
+}
+
 }  // namespace crypto
 }  // namespace node
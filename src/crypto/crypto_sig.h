@@ -161,6 +161,52 @@ struct SignTraits final {
 
 using SignJob = DeriveBitsJob<SignTraits>;
 
+// Signs or verifies many inputs with the same key and options in one call.
+// The inputs (and, when verifying, the signatures) are passed as a single
+// buffer plus an array of offsets delimiting the individual items.
+struct SignBatchConfiguration final : public MemoryRetainer {
+  SignConfiguration base;
+  std::vector<uint32_t> data_offsets;
+  std::vector<ByteSource> signatures;
+
+  SignBatchConfiguration() = default;
+
+  explicit SignBatchConfiguration(SignBatchConfiguration&& other) noexcept;
+
+  SignBatchConfiguration& operator=(SignBatchConfiguration&& other) noexcept;
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(SignBatchConfiguration)
+  SET_SELF_SIZE(SignBatchConfiguration)
+};
+
+struct SignBatchTraits final {
+  using AdditionalParameters = SignBatchConfiguration;
+  static constexpr const char* JobName = "SignBatchJob";
+
+  static constexpr AsyncWrap::ProviderType Provider =
+      AsyncWrap::PROVIDER_SIGNREQUEST;
+
+  static v8::Maybe<bool> AdditionalConfig(
+      CryptoJobMode mode,
+      const v8::FunctionCallbackInfo<v8::Value>& args,
+      unsigned int offset,
+      SignBatchConfiguration* params);
+
+  static bool DeriveBits(
+      Environment* env,
+      const SignBatchConfiguration& params,
+      ByteSource* out);
+
+  static v8::Maybe<bool> EncodeOutput(
+      Environment* env,
+      const SignBatchConfiguration& params,
+      ByteSource* out,
+      v8::Local<v8::Value>* result);
+};
+
+using SignBatchJob = DeriveBitsJob<SignBatchTraits>;
+
 }  // namespace crypto
 }  // namespace node
 
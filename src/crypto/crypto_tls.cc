@@ -31,8 +31,11 @@
 #include "node_buffer.h"
 #include "node_errors.h"
 #include "stream_base-inl.h"
+#include "threadpoolwork-inl.h"
 #include "util-inl.h"
 
+#include <openssl/async.h>
+
 namespace node {
 
 using v8::Array;
@@ -64,6 +67,32 @@ using v8::Value;
 namespace crypto {
 
 namespace {
+// The TLSWrap whose handshake the current SSL_read() call runs in an OpenSSL
+// async job, if any. Used by the private key operations that the handshake
+// performs, see TLSWrap::OffloadRSAPrivateEncrypt().
+thread_local TLSWrap* offloading_tls_wrap = nullptr;
+
+class OffloadingTLSWrapScope {
+ public:
+  explicit OffloadingTLSWrapScope(TLSWrap* wrap)
+      : previous_(offloading_tls_wrap) {
+    offloading_tls_wrap = wrap;
+  }
+  ~OffloadingTLSWrapScope() { offloading_tls_wrap = previous_; }
+
+ private:
+  TLSWrap* previous_;
+};
+
+int RSAPrivateEncrypt(int flen,
+                      const unsigned char* from,
+                      unsigned char* to,
+                      RSA* rsa,
+                      int padding) {
+  return RSA_meth_get_priv_enc(RSA_PKCS1_OpenSSL())(
+      flen, from, to, rsa, padding);
+}
+
 SSL_SESSION* GetSessionCallback(
     SSL* s,
     const unsigned char* key,
@@ -71,7 +100,15 @@ SSL_SESSION* GetSessionCallback(
     int* copy) {
   TLSWrap* w = static_cast<TLSWrap*>(SSL_get_app_data(s));
   *copy = 0;
-  return w->ReleaseSession();
+  // A session loaded through the 'resumeSession' event takes precedence.
+  SSL_SESSION* session = w->ReleaseSession();
+  if (session == nullptr) {
+    SecureContext* sc = static_cast<SecureContext*>(
+        SSL_CTX_get_app_data(SSL_get_SSL_CTX(s)));
+    if (sc != nullptr && sc->shared_session_cache() != nullptr)
+      session = sc->shared_session_cache()->Lookup(key, len).release();
+  }
+  return session;
 }
 
 void OnClientHello(
@@ -113,6 +150,12 @@ void OnClientHello(
 
 void KeylogCallback(const SSL* s, const char* line) {
   TLSWrap* w = static_cast<TLSWrap*>(SSL_get_app_data(s));
+  if (ASYNC_get_current_job() != nullptr) {
+    // Running on the stack of an async job, see MaybeStartPrivateKeyOffload().
+    w->pending_keylog_lines_.emplace_back(line);
+    return;
+  }
+
   Environment* env = w->env();
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
@@ -134,6 +177,13 @@ int NewSessionCallback(SSL* s, SSL_SESSION* sess) {
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
+  if (w->is_server()) {
+    SecureContext* sc = static_cast<SecureContext*>(
+        SSL_CTX_get_app_data(SSL_get_SSL_CTX(s)));
+    if (sc != nullptr && sc->shared_session_cache() != nullptr)
+      sc->shared_session_cache()->Add(sess);
+  }
+
   if (!w->has_session_callbacks())
     return 0;
 
@@ -182,7 +232,7 @@ int SSLCertCallback(SSL* s, void* arg) {
   TLSWrap* w = static_cast<TLSWrap*>(SSL_get_app_data(s));
 
   if (!w->is_server() || !w->is_waiting_cert_cb())
-    return 1;
+    return w->MaybeStartPrivateKeyOffload();
 
   if (w->is_cert_cb_running())
     // Not an error. Suspend handshake with SSL_ERROR_WANT_X509_LOOKUP, and
@@ -213,7 +263,7 @@ int SSLCertCallback(SSL* s, void* arg) {
   Local<Value> argv[] = { info };
   w->MakeCallback(env->oncertcb_string(), arraysize(argv), argv);
 
-  return w->is_cert_cb_running() ? -1 : 1;
+  return w->is_cert_cb_running() ? -1 : w->MaybeStartPrivateKeyOffload();
 }
 
 int SelectALPNCallback(
@@ -729,6 +779,219 @@ void TLSWrap::OnStreamAfterWrite(WriteWrap* req_wrap, int status) {
   EncOut();
 }
 
+// Runs the private key operation of a handshake on the thread pool while the
+// async job of the handshake is suspended, and resumes the job afterwards.
+class TLSWrap::PrivateKeyOperation final : public ThreadPoolWork {
+ public:
+  PrivateKeyOperation(TLSWrap* wrap,
+                      int flen,
+                      const unsigned char* from,
+                      RSA* rsa,
+                      int padding)
+      : ThreadPoolWork(wrap->env(), "tls"),
+        wrap_(wrap),
+        sc_(static_cast<SecureContext*>(
+            SSL_CTX_get_app_data(SSL_get_SSL_CTX(wrap->ssl_.get())))),
+        in_(from, from + flen),
+        out_(RSA_size(rsa)),
+        padding_(padding) {
+    // The SSL and the key outlive the TLSWrap if it is destroyed meanwhile.
+    CHECK_EQ(SSL_up_ref(wrap->ssl_.get()), 1);
+    ssl_.reset(wrap->ssl_.get());
+    CHECK_EQ(RSA_up_ref(rsa), 1);
+    rsa_.reset(rsa);
+  }
+
+  bool done() const { return done_; }
+
+  // Copies the output to |to|, and returns its length or -1 on failure.
+  int TakeResult(unsigned char* to) const {
+    if (result_ > 0)
+      memcpy(to, out_.data(), result_);
+    return result_;
+  }
+
+  void DoThreadPoolWork() override {
+    ClearErrorOnReturn clear_error_on_return;
+    result_ = RSAPrivateEncrypt(
+        in_.size(), in_.data(), out_.data(), rsa_.get(), padding_);
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<PrivateKeyOperation> self(this);
+    done_ = true;
+    if (status != 0)
+      result_ = -1;
+    if (result_ > 0 && sc_)
+      sc_->CountPrivateKeyOffload();
+
+    if (wrap_->ssl_.get() != ssl_.get()) {
+      // The TLSWrap was destroyed. Fail the operation, so that the suspended
+      // handshake fails, too, and its async job is released before the SSL.
+      Debug(wrap_.get(), "Private key operation done after destruction");
+      result_ = -1;
+      MarkPopErrorOnReturn mark_pop_error_on_return;
+      char byte;
+      SSL_read(ssl_.get(), &byte, 1);
+      return;
+    }
+
+    Debug(wrap_.get(), "Private key operation done, resuming handshake");
+    Environment* env = this->env();
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+    InternalCallbackScope callback_scope(wrap_.get());
+    wrap_->Cycle();
+    wrap_->EmitPendingKeylogLines();
+  }
+
+ private:
+  BaseObjectPtr<TLSWrap> wrap_;
+  BaseObjectPtr<SecureContext> sc_;
+  SSLPointer ssl_;
+  RSAPointer rsa_;
+  std::vector<unsigned char> in_;
+  std::vector<unsigned char> out_;
+  int padding_;
+  int result_ = -1;
+  bool done_ = false;
+};
+
+int TLSWrap::MaybeStartPrivateKeyOffload() {
+  switch (private_key_offload_) {
+    case PrivateKeyOffload::kNone:
+      break;
+    case PrivateKeyOffload::kPending:
+      return -1;
+    case PrivateKeyOffload::kActive:
+    case PrivateKeyOffload::kDone:
+      return 1;
+  }
+
+  // The ALPN callback calls into JS, which is not possible from within an
+  // async job.
+  if (!is_server() || alpn_callback_enabled_ || !ASYNC_is_capable())
+    return 1;
+
+  SecureContext* sc = static_cast<SecureContext*>(
+      SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl_.get())));
+  if (sc == nullptr || !sc->private_key_offload())
+    return 1;
+
+  EVP_PKEY* key = SSL_get_privatekey(ssl_.get());
+  if (key == nullptr)
+    return 1;
+
+  MarkPopErrorOnReturn mark_pop_error_on_return;
+  EVP_PKEY* offload_key = sc->GetOffloadKey(key);
+  if (offload_key == nullptr) {
+    EVPKeyPointer new_key = NewOffloadKey(key);
+    if (!new_key)
+      return 1;
+    offload_key = sc->AddOffloadKey(key, std::move(new_key));
+  }
+
+  if (!SSL_use_PrivateKey(ssl_.get(), offload_key))
+    return 1;
+
+  Debug(this, "Offloading private key operation");
+  CHECK_EQ(EVP_PKEY_up_ref(key), 1);
+  private_key_offload_key_.reset(key);
+  private_key_offload_ = PrivateKeyOffload::kPending;
+  // Suspend the handshake with SSL_ERROR_WANT_X509_LOOKUP, so that ClearOut()
+  // can continue it in an async job.
+  return -1;
+}
+
+bool TLSWrap::ContinuePrivateKeyOffload(int read) {
+  const int err = read > 0 ? SSL_ERROR_NONE : SSL_get_error(ssl_.get(), read);
+  if (private_key_offload_ == PrivateKeyOffload::kPending) {
+    if (err == SSL_ERROR_WANT_X509_LOOKUP) {
+      SSL_set_mode(ssl_.get(), SSL_MODE_ASYNC);
+      private_key_offload_ = PrivateKeyOffload::kActive;
+      return true;
+    }
+  } else if (err == SSL_ERROR_WANT_ASYNC) {
+    // Resumed by the PrivateKeyOperation.
+    return false;
+  }
+
+  EndPrivateKeyOffload();
+  return false;
+}
+
+void TLSWrap::EndPrivateKeyOffload() {
+  Debug(this, "Restoring private key");
+  private_key_offload_ = PrivateKeyOffload::kDone;
+  // Later handshake messages run without an async job again. Restoring the
+  // key matters for the decryption of RSA key exchanges, which OpenSSL does
+  // not support for keys with an RSA_METHOD of their own.
+  SSL_clear_mode(ssl_.get(), SSL_MODE_ASYNC);
+  CHECK_EQ(SSL_use_PrivateKey(ssl_.get(), private_key_offload_key_.get()), 1);
+  private_key_offload_key_.reset();
+}
+
+void TLSWrap::EmitPendingKeylogLines() {
+  std::vector<std::string> lines = std::move(pending_keylog_lines_);
+  for (const std::string& line : lines) {
+    // 'keylog' listeners may destroy the socket.
+    if (ssl_ == nullptr)
+      return;
+    KeylogCallback(ssl_.get(), line.c_str());
+  }
+}
+
+EVPKeyPointer TLSWrap::NewOffloadKey(EVP_PKEY* key) {
+  // Intentionally never freed, it is shared by all offload keys.
+  static RSA_METHOD* method = []() {
+    RSA_METHOD* method = RSA_meth_dup(RSA_PKCS1_OpenSSL());
+    CHECK_NOT_NULL(method);
+    CHECK_EQ(RSA_meth_set1_name(method, "node.js TLS offload"), 1);
+    CHECK_EQ(RSA_meth_set_priv_enc(method, OffloadRSAPrivateEncrypt), 1);
+    return method;
+  }();
+
+  if (EVP_PKEY_id(key) != EVP_PKEY_RSA)
+    return EVPKeyPointer();
+
+  RSAPointer rsa(EVP_PKEY_get1_RSA(key));
+  if (!rsa)
+    return EVPKeyPointer();
+  RSAPointer copy(RSAPrivateKey_dup(rsa.get()));
+  if (!copy || !RSA_set_method(copy.get(), method))
+    return EVPKeyPointer();
+
+  EVPKeyPointer offload_key(EVP_PKEY_new());
+  if (!offload_key || !EVP_PKEY_assign_RSA(offload_key.get(), copy.get()))
+    return EVPKeyPointer();
+  copy.release();
+  return offload_key;
+}
+
+int TLSWrap::OffloadRSAPrivateEncrypt(int flen,
+                                      const unsigned char* from,
+                                      unsigned char* to,
+                                      RSA* rsa,
+                                      int padding) {
+  TLSWrap* w = offloading_tls_wrap;
+  if (w == nullptr || ASYNC_get_current_job() == nullptr)
+    return RSAPrivateEncrypt(flen, from, to, rsa, padding);
+
+  PrivateKeyOperation* op =
+      new PrivateKeyOperation(w, flen, from, rsa, padding);
+  w->private_key_op_ = op;
+  op->ScheduleWork();
+
+  // SSL_read() returns with SSL_ERROR_WANT_ASYNC until the operation calls it
+  // again to resume the job.
+  do {
+    CHECK_EQ(ASYNC_pause_job(), 1);
+  } while (!op->done());
+
+  w->private_key_op_ = nullptr;
+  return op->TakeResult(to);
+}
+
 void TLSWrap::ClearOut() {
   Debug(this, "Trying to read cleartext output");
   // Ignore cycling data if ClientHello wasn't yet parsed
@@ -737,8 +1000,14 @@ void TLSWrap::ClearOut() {
     return;
   }
 
-  // No reads after EOF
-  if (eof_) {
+  if (private_key_op_ != nullptr && !private_key_op_->done()) {
+    Debug(this, "Returning from ClearOut(), private key operation running");
+    return;
+  }
+
+  // No reads after EOF, except for resuming a suspended handshake, which
+  // would otherwise never finish.
+  if (eof_ && private_key_offload_ != PrivateKeyOffload::kActive) {
     Debug(this, "Returning from ClearOut(), EOF reached");
     return;
   }
@@ -753,9 +1022,18 @@ void TLSWrap::ClearOut() {
   char out[kClearOutChunkSize];
   int read;
   for (;;) {
-    read = SSL_read(ssl_.get(), out, sizeof(out));
+    {
+      OffloadingTLSWrapScope offloading_scope(this);
+      read = SSL_read(ssl_.get(), out, sizeof(out));
+    }
     Debug(this, "Read %d bytes of cleartext output", read);
 
+    if ((private_key_offload_ == PrivateKeyOffload::kPending ||
+         private_key_offload_ == PrivateKeyOffload::kActive) &&
+        ContinuePrivateKeyOffload(read)) {
+      continue;
+    }
+
     if (read <= 0)
       break;
 
@@ -868,6 +1146,12 @@ void TLSWrap::ClearIn() {
     return;
   }
 
+  // SSL_write() would resume the suspended handshake in place of SSL_read().
+  if (private_key_offload_ == PrivateKeyOffload::kActive) {
+    Debug(this, "Returning from ClearIn(), private key operation running");
+    return;
+  }
+
   std::unique_ptr<BackingStore> bs = std::move(pending_cleartext_input_);
   MarkPopErrorOnReturn mark_pop_error_on_return;
 
@@ -1018,6 +1302,10 @@ int TLSWrap::DoWrite(WriteWrap* w,
   MarkPopErrorOnReturn mark_pop_error_on_return;
 
   int written = 0;
+  // While the handshake is suspended for a private key operation, keep the
+  // data for ClearIn(), because SSL_write() would resume the handshake in
+  // place of SSL_read().
+  const bool suspended = private_key_offload_ == PrivateKeyOffload::kActive;
 
   // It is common for zero length buffers to be written,
   // don't copy data if there there is one buffer with data
@@ -1040,12 +1328,12 @@ int TLSWrap::DoWrite(WriteWrap* w,
     }
 
     NodeBIO::FromBIO(enc_out_)->set_allocate_tls_hint(length);
-    written = SSL_write(ssl_.get(), bs->Data(), length);
+    written = suspended ? -1 : SSL_write(ssl_.get(), bs->Data(), length);
   } else {
     // Only one buffer: try to write directly, only store if it fails
     uv_buf_t* buf = &bufs[nonempty_i];
     NodeBIO::FromBIO(enc_out_)->set_allocate_tls_hint(buf->len);
-    written = SSL_write(ssl_.get(), buf->base, buf->len);
+    written = suspended ? -1 : SSL_write(ssl_.get(), buf->base, buf->len);
 
     if (written == -1) {
       NoArrayBufferZeroFillScope no_zero_fill_scope(env()->isolate_data());
@@ -1059,7 +1347,8 @@ int TLSWrap::DoWrite(WriteWrap* w,
 
   if (written == -1) {
     // If we stopped writing because of an error, it's fatal, discard the data.
-    int err = SSL_get_error(ssl_.get(), written);
+    int err = suspended ? SSL_ERROR_WANT_ASYNC
+                        : SSL_get_error(ssl_.get(), written);
     if (err == SSL_ERROR_SSL || err == SSL_ERROR_SYSCALL) {
       // TODO(@jasnell): What are we doing with the error?
       Debug(this, "Got SSL error (%d), returning UV_EPROTO", err);
@@ -1145,8 +1434,11 @@ int TLSWrap::DoShutdown(ShutdownWrap* req_wrap) {
   Debug(this, "DoShutdown()");
   MarkPopErrorOnReturn mark_pop_error_on_return;
 
-  if (ssl_ && SSL_shutdown(ssl_.get()) == 0)
+  // SSL_shutdown() would resume a suspended handshake, too, see DoWrite().
+  if (ssl_ && private_key_offload_ != PrivateKeyOffload::kActive &&
+      SSL_shutdown(ssl_.get()) == 0) {
     SSL_shutdown(ssl_.get());
+  }
 
   shutdown_ = true;
   EncOut();
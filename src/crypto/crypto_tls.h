@@ -98,6 +98,12 @@ class TLSWrap : public AsyncWrap,
   // Called by the done() callback of the 'newSession' event.
   void NewSessionDoneCb();
 
+  // Called by the certificate callback of OpenSSL once the certificate and
+  // the private key for a server handshake are settled. Returns -1 to
+  // suspend the handshake if it is to continue with the private key
+  // operation on the thread pool, and 1 otherwise.
+  int MaybeStartPrivateKeyOffload();
+
   // Implement MemoryRetainer:
   void MemoryInfo(MemoryTracker* tracker) const override;
   SET_MEMORY_INFO_NAME(TLSWrap)
@@ -126,6 +132,19 @@ class TLSWrap : public AsyncWrap,
 
   typedef void (*CertCb)(void* arg);
 
+  // State of running the private key operation of a server handshake on the
+  // thread pool. OpenSSL offers no hook for that, so the key is swapped for a
+  // copy whose RSA_METHOD suspends the OpenSSL async job (SSL_MODE_ASYNC)
+  // that runs the handshake until the thread pool is done with it.
+  enum class PrivateKeyOffload {
+    kNone,     // Not started.
+    kPending,  // Waiting for ClearOut() to continue the handshake async.
+    kActive,   // The handshake runs in an async job.
+    kDone      // The original private key has been restored.
+  };
+
+  class PrivateKeyOperation;
+
   // Alternative to StreamListener::stream(), that returns a StreamBase instead
   // of a StreamResource.
   StreamBase* underlying_stream() const {
@@ -154,6 +173,19 @@ class TLSWrap : public AsyncWrap,
   void ClearOut();  // SSL_read() clear text "out" from SSL.
   void Destroy();
 
+  // Called by ClearOut() after SSL_read() while private_key_offload_ is
+  // kPending or kActive. Returns true if SSL_read() is to be called again.
+  bool ContinuePrivateKeyOffload(int read);
+  void EndPrivateKeyOffload();
+  void EmitPendingKeylogLines();
+
+  static EVPKeyPointer NewOffloadKey(EVP_PKEY* key);
+  static int OffloadRSAPrivateEncrypt(int flen,
+                                      const unsigned char* from,
+                                      unsigned char* to,
+                                      RSA* rsa,
+                                      int padding);
+
   // Call Done() on outstanding WriteWrap request.
   void InvokeQueued(int status, const char* error_str = nullptr);
 
@@ -291,9 +323,19 @@ class TLSWrap : public AsyncWrap,
 
   bool has_active_write_issued_by_prev_listener_ = false;
 
+  PrivateKeyOffload private_key_offload_ = PrivateKeyOffload::kNone;
+  // Owned by the thread pool work, which deletes itself once it resumed the
+  // handshake.
+  PrivateKeyOperation* private_key_op_ = nullptr;
+  // The key that is restored by EndPrivateKeyOffload().
+  EVPKeyPointer private_key_offload_key_;
+
  public:
   std::vector<unsigned char> alpn_protos_;  // Accessed by SelectALPNCallback.
   bool alpn_callback_enabled_ = false;      // Accessed by SelectALPNCallback.
+  // Accessed by KeylogCallback, which cannot call into JS while an OpenSSL
+  // async job runs.
+  std::vector<std::string> pending_keylog_lines_;
 };
 
 }  // namespace crypto
@@ -19,6 +19,9 @@
 
 #include <openssl/rand.h>
 
+#include <atomic>
+#include <unordered_map>
+
 namespace node {
 
 using v8::ArrayBuffer;
@@ -223,6 +226,11 @@ void GetFipsCrypto(const FunctionCallbackInfo<Value>& args) {
 #endif
 }
 
+// Incremented whenever the FIPS mode changes, which invalidates the
+// implementations cached by GetDigestImplementation() and
+// GetCipherImplementation(), and the keys cached by crypto_keys.cc.
+static std::atomic<uint32_t> fips_generation{0};
+
 void SetFipsCrypto(const FunctionCallbackInfo<Value>& args) {
   Mutex::ScopedLock lock(per_process::cli_options_mutex);
   Mutex::ScopedLock fips_lock(fips_mutex);
@@ -248,6 +256,11 @@ void SetFipsCrypto(const FunctionCallbackInfo<Value>& args) {
     unsigned long err = ERR_get_error();  // NOLINT(runtime/int)
     return ThrowCryptoError(env, err);
   }
+  fips_generation++;
+}
+
+uint32_t GetFipsGeneration() {
+  return fips_generation.load();
 }
 
 void TestFipsCrypto(const v8::FunctionCallbackInfo<v8::Value>& args) {
@@ -272,6 +285,99 @@ void TestFipsCrypto(const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().Set(enabled);
 }
 
+#if OPENSSL_VERSION_MAJOR >= 3
+namespace {
+// A per-process cache of algorithm implementations that have been fetched
+// from the providers. Looking up an algorithm by name, or passing a legacy
+// EVP_MD/EVP_CIPHER to EVP_DigestInit_ex()/EVP_CipherInit_ex(), makes OpenSSL
+// search the provider store under a lock every time, which is a point of
+// contention when many threads use the same few algorithms.
+//
+// Entries are never removed, because callers keep using the returned pointers
+// without holding a reference of their own. Entries fetched before a FIPS mode
+// change are simply no longer looked up.
+template <class TypeName,
+          TypeName* fetch_type(OSSL_LIB_CTX*, const char*, const char*),
+          void free_type(TypeName*),
+          const TypeName* getbyname(const char*),
+          const char* getname(const TypeName*)>
+class ImplementationCache {
+ public:
+  static const TypeName* Get(const char* name) {
+    static ImplementationCache* cache = new ImplementationCache();
+    return cache->Lookup(name);
+  }
+
+ private:
+  const TypeName* Lookup(const char* name) {
+    std::string key = std::to_string(GetFipsGeneration()) + ':' + name;
+    {
+      RwLock::ScopedReadLock lock(lock_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) return it->second;
+    }
+
+    MarkPopErrorOnReturn mark_pop_error_on_return;
+    // getbyname() also knows about legacy aliases such as "RSA-SHA256" that
+    // fetch_type() does not accept.
+    const TypeName* legacy = getbyname(name);
+    if (legacy == nullptr) return nullptr;
+    const TypeName* fetched = fetch_type(nullptr, getname(legacy), nullptr);
+    // Algorithms that no provider offers keep using the legacy object, so
+    // that the error surfaces wherever it did before.
+    if (fetched == nullptr) fetched = legacy;
+
+    RwLock::ScopedWriteLock lock(lock_);
+    auto result = entries_.emplace(std::move(key), fetched);
+    if (!result.second && fetched != legacy) {
+      // Another thread fetched the same algorithm in the meantime.
+      free_type(const_cast<TypeName*>(fetched));
+    }
+    return result.first->second;
+  }
+
+  RwLock lock_;
+  std::unordered_map<std::string, const TypeName*> entries_;
+};
+
+using DigestCache = ImplementationCache<EVP_MD,
+                                        EVP_MD_fetch,
+                                        EVP_MD_free,
+                                        EVP_get_digestbyname,
+                                        EVP_MD_get0_name>;
+using CipherCache = ImplementationCache<EVP_CIPHER,
+                                        EVP_CIPHER_fetch,
+                                        EVP_CIPHER_free,
+                                        EVP_get_cipherbyname,
+                                        EVP_CIPHER_get0_name>;
+}  // namespace
+#endif
+
+const EVP_MD* GetDigestImplementation(const char* name) {
+#if OPENSSL_VERSION_MAJOR >= 3
+  return DigestCache::Get(name);
+#else
+  return EVP_get_digestbyname(name);
+#endif
+}
+
+const EVP_CIPHER* GetCipherImplementation(const char* name) {
+#if OPENSSL_VERSION_MAJOR >= 3
+  return CipherCache::Get(name);
+#else
+  return EVP_get_cipherbyname(name);
+#endif
+}
+
+const EVP_CIPHER* GetCipherImplementation(int nid) {
+#if OPENSSL_VERSION_MAJOR >= 3
+  const char* name = OBJ_nid2sn(nid);
+  return name != nullptr ? CipherCache::Get(name) : nullptr;
+#else
+  return EVP_get_cipherbynid(nid);
+#endif
+}
+
 void CryptoErrorStore::Capture() {
   errors_.clear();
   while (const uint32_t err = ERR_get_error()) {
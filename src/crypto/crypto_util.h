@@ -613,6 +613,22 @@ void SetFipsCrypto(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 void TestFipsCrypto(const v8::FunctionCallbackInfo<v8::Value>& args);
 
+// Returns a counter that changes whenever the FIPS mode is toggled. Caches of
+// OpenSSL objects include it in their keys to avoid handing out objects that
+// were created under a different mode.
+uint32_t GetFipsGeneration();
+
+// Return the digest or cipher implementation for |name| (or |nid|), or
+// nullptr if the algorithm is not supported. With OpenSSL 3, implementations
+// are fetched from the providers once per process and cached, so that
+// EVP_DigestInit_ex() and EVP_CipherInit_ex() do not need to perform an
+// implicit fetch. The returned pointers remain valid for the lifetime of the
+// process. These should be used instead of EVP_get_digestbyname() and
+// EVP_get_cipherbyname().
+const EVP_MD* GetDigestImplementation(const char* name);
+const EVP_CIPHER* GetCipherImplementation(const char* name);
+const EVP_CIPHER* GetCipherImplementation(int nid);
+
 class CipherPushContext {
  public:
   inline explicit CipherPushContext(Environment* env) : env_(env) {}
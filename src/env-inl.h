@@ -392,6 +392,18 @@ inline builtins::BuiltinLoader* Environment::builtin_loader() {
   return &builtin_loader_;
 }
 
+inline CompileCacheHandler* Environment::compile_cache_handler() {
+  return compile_cache_handler_.get();
+}
+
+inline bool Environment::use_compile_cache() const {
+  return compile_cache_handler_ != nullptr;
+}
+
+inline ResolutionCache* Environment::resolution_cache() {
+  return resolution_cache_.get();
+}
+
 inline double Environment::new_async_id() {
   async_hooks()->async_id_fields()[AsyncHooks::kAsyncIdCounter] += 1;
   return async_hooks()->async_id_fields()[AsyncHooks::kAsyncIdCounter];
@@ -919,6 +919,52 @@ void Environment::InitializeLibuv() {
   StartProfilerIdleNotifier();
 }
 
+void Environment::InitializeCompileCache() {
+  std::string dir;
+  if (!credentials::SafeGetenv("NODE_COMPILE_CACHE", &dir, env_vars(),
+                               isolate()) ||
+      dir.empty()) {
+    return;
+  }
+  // The code cache of the modules loaded while building a snapshot is
+  // part of the snapshot already.
+  if (per_process::cli_options->build_snapshot) return;
+
+  auto handler = std::make_unique<CompileCacheHandler>(this);
+  if (handler->InitializeDirectory(dir)) {
+    compile_cache_handler_ = std::move(handler);
+    AtExit(
+        [](void* env) { static_cast<Environment*>(env)->FlushCompileCache(); },
+        this);
+  }
+}
+
+void Environment::FlushCompileCache() {
+  if (compile_cache_handler_ != nullptr) compile_cache_handler_->Persist();
+}
+
+void Environment::InitializeResolutionCache() {
+  std::string path;
+  if (!credentials::SafeGetenv("NODE_RESOLUTION_CACHE", &path, env_vars(),
+                               isolate()) ||
+      path.empty()) {
+    return;
+  }
+  // The file system of the machine that builds a snapshot is usually not
+  // the one of the machines that run it.
+  if (per_process::cli_options->build_snapshot) return;
+
+  resolution_cache_ = std::make_unique<ResolutionCache>(this, std::move(path));
+  resolution_cache_->Load();
+  AtExit(
+      [](void* env) { static_cast<Environment*>(env)->FlushResolutionCache(); },
+      this);
+}
+
+void Environment::FlushResolutionCache() {
+  if (resolution_cache_ != nullptr) resolution_cache_->Persist();
+}
+
 void Environment::ExitEnv(StopFlags::Flags flags) {
   // Should not access non-thread-safe methods here.
   set_stopping(true);
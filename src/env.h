@@ -31,6 +31,7 @@
 #endif
 #include "callback_queue.h"
 #include "cleanup_queue-inl.h"
+#include "compile_cache.h"
 #include "debug_utils.h"
 #include "env_properties.h"
 #include "handle_wrap.h"
@@ -43,6 +44,7 @@
 #include "node_realm.h"
 #include "node_snapshotable.h"
 #include "req_wrap.h"
+#include "resolution_cache.h"
 #include "util.h"
 #include "uv.h"
 #include "v8.h"
@@ -56,6 +58,7 @@
 #include <ostream>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -519,6 +522,7 @@ struct SnapshotData {
   // and the caller should not consume the snapshot data.
   bool Check() const;
   static bool FromBlob(SnapshotData* out, FILE* in);
+  static bool FromBlob(SnapshotData* out, std::string_view in);
 
   ~SnapshotData();
 };
@@ -697,6 +701,21 @@ class Environment : public MemoryRetainer {
 
   builtins::BuiltinLoader* builtin_loader();
 
+  // Enables the on-disk code cache of user modules if NODE_COMPILE_CACHE
+  // is set.
+  void InitializeCompileCache();
+  // Writes the code cache of the user modules compiled so far.
+  void FlushCompileCache();
+  inline CompileCacheHandler* compile_cache_handler();
+  inline bool use_compile_cache() const;
+
+  // Enables the persistent cache of module resolution lookups if
+  // NODE_RESOLUTION_CACHE is set.
+  void InitializeResolutionCache();
+  // Writes the resolution cache file, if any lookup has changed.
+  void FlushResolutionCache();
+  inline ResolutionCache* resolution_cache();
+
   std::unordered_multimap<int, loader::ModuleWrap*> hash_to_module_map;
   std::unordered_map<uint32_t, loader::ModuleWrap*> id_to_module_map;
   std::unordered_map<uint32_t, contextify::ContextifyScript*>
@@ -1102,6 +1121,8 @@ class Environment : public MemoryRetainer {
   std::unique_ptr<Realm> principal_realm_ = nullptr;
 
   builtins::BuiltinLoader builtin_loader_;
+  std::unique_ptr<CompileCacheHandler> compile_cache_handler_;
+  std::unique_ptr<ResolutionCache> resolution_cache_;
 
   // Used by allocate_managed_buffer() and release_managed_buffer() to keep
   // track of the BackingStore for a given pointer.
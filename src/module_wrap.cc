@@ -136,7 +136,8 @@ void ModuleWrap::New(const FunctionCallbackInfo<Value>& args) {
     // new ModuleWrap(url, context, exportNames, syntheticExecutionFunction)
     CHECK(args[3]->IsFunction());
   } else {
-    // new ModuleWrap(url, context, source, lineOffset, columOffset, cachedData)
+    // new ModuleWrap(url, context, source, lineOffset, columOffset,
+    //                cachedData, useCompileCache)
     CHECK(args[2]->IsString());
     CHECK(args[3]->IsNumber());
     line_offset = args[3].As<Int32>()->Value();
@@ -184,6 +185,14 @@ void ModuleWrap::New(const FunctionCallbackInfo<Value>& args) {
       }
 
       Local<String> source_text = args[2].As<String>();
+      CompileCacheEntry* cache_entry = nullptr;
+      if (cached_data == nullptr && args[6]->IsTrue() &&
+          env->use_compile_cache()) {
+        cache_entry = env->compile_cache_handler()->GetOrInsert(
+            source_text, url, CachedCodeType::kESM);
+        if (cache_entry != nullptr && cache_entry->cache != nullptr)
+          cached_data = cache_entry->CopyCache();
+      }
       ScriptOrigin origin(isolate,
                           url,
                           line_offset,
@@ -213,8 +222,11 @@ void ModuleWrap::New(const FunctionCallbackInfo<Value>& args) {
         }
         return;
       }
-      if (options == ScriptCompiler::kConsumeCodeCache &&
-          source.GetCachedData()->rejected) {
+      bool rejected = options == ScriptCompiler::kConsumeCodeCache &&
+                      source.GetCachedData()->rejected;
+      if (cache_entry != nullptr) {
+        env->compile_cache_handler()->MaybeSave(cache_entry, module, rejected);
+      } else if (rejected) {
         THROW_ERR_VM_MODULE_CACHED_DATA_REJECTED(
             env, "cachedData buffer was rejected");
         try_catch.ReThrow();
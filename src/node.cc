@@ -127,6 +127,7 @@
 #include <cstring>
 
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -1178,7 +1179,8 @@ int GenerateAndWriteSnapshotData(const SnapshotData** snapshot_data_ptr,
 }
 
 int LoadSnapshotDataAndRun(const SnapshotData** snapshot_data_ptr,
-                           const InitializationResult* result) {
+                           const InitializationResult* result,
+                           std::string_view app_snapshot_blob) {
   int exit_code = result->exit_code();
   // nullptr indicates there's no snapshot data.
   DCHECK_NULL(*snapshot_data_ptr);
@@ -1200,6 +1202,14 @@ int LoadSnapshotDataAndRun(const SnapshotData** snapshot_data_ptr,
       return exit_code;
     }
     *snapshot_data_ptr = read_data.release();
+  } else if (!app_snapshot_blob.empty()) {
+    // An application snapshot handed over by the embedder.
+    std::unique_ptr<SnapshotData> read_data = std::make_unique<SnapshotData>();
+    if (!SnapshotData::FromBlob(read_data.get(), app_snapshot_blob)) {
+      exit_code = 1;
+      return exit_code;
+    }
+    *snapshot_data_ptr = read_data.release();
   } else if (per_process::cli_options->node_snapshot) {
     // If --snapshot-blob is not specified, we are reading the embedded
     // snapshot, but we will skip it if --no-node-snapshot is specified.
@@ -1221,7 +1231,9 @@ int LoadSnapshotDataAndRun(const SnapshotData** snapshot_data_ptr,
   return exit_code;
 }
 
-int Start(int argc, char** argv) {
+static int StartInternal(int argc,
+                         char** argv,
+                         std::string_view app_snapshot_blob) {
 #ifndef DISABLE_SINGLE_EXECUTABLE_APPLICATION
   std::tie(argc, argv) = sea::FixupArgsForSEA(argc, argv);
 #endif
@@ -1266,7 +1278,22 @@ int Start(int argc, char** argv) {
   }
 
   // Without --build-snapshot, we are in snapshot loading mode.
-  return LoadSnapshotDataAndRun(&snapshot_data, result.get());
+  return LoadSnapshotDataAndRun(
+      &snapshot_data, result.get(), app_snapshot_blob);
+}
+
+int Start(int argc, char** argv) {
+  return StartInternal(argc, argv, std::string_view());
+}
+
+int Start(int argc,
+          char** argv,
+          const char* snapshot_blob,
+          size_t snapshot_blob_size) {
+  CHECK_NOT_NULL(snapshot_blob);
+  CHECK_GT(snapshot_blob_size, 0);
+  return StartInternal(
+      argc, argv, std::string_view(snapshot_blob, snapshot_blob_size));
 }
 
 int Stop(Environment* env) {
@@ -317,6 +317,21 @@ class NODE_EXTERN InitializationResult {
 // better suited for a public embedder API.
 NODE_EXTERN int Start(int argc, char* argv[]);
 
+// Like Start(), but boots from an application snapshot instead of the
+// built-in one. |snapshot_blob| holds the contents of a file written by
+// `node --snapshot-blob <file> --build-snapshot <entry.js>` with a Node.js
+// binary of the same version, architecture and platform. This lets embedders
+// that cannot pass a file path with --snapshot-blob, e.g. because the blob is
+// an asset mapped into memory, skip running the application's initialization
+// code on every launch. The blob is only read during startup and can be
+// released once the main script runs. If it does not match this binary, an
+// error is printed and 1 is returned. --snapshot-blob in |argv| takes
+// precedence over |snapshot_blob|.
+NODE_EXTERN int Start(int argc,
+                      char* argv[],
+                      const char* snapshot_blob,
+                      size_t snapshot_blob_size);
+
 // Tear down Node.js while it is running (there are active handles
 // in the loop and / or actively executing JavaScript code).
 NODE_EXTERN int Stop(Environment* env);
@@ -34,6 +34,7 @@
 #include "util-inl.h"
 #include "v8.h"
 
+#include <algorithm>
 #include <cstring>
 #include <climits>
 
@@ -54,8 +55,10 @@ namespace Buffer {
 using v8::ArrayBuffer;
 using v8::ArrayBufferView;
 using v8::BackingStore;
+using v8::CFunction;
 using v8::Context;
 using v8::EscapableHandleScope;
+using v8::FastApiCallbackOptions;
 using v8::FunctionCallbackInfo;
 using v8::Global;
 using v8::HandleScope;
@@ -229,6 +232,25 @@ inline MUST_USE_RESULT Maybe<bool> ParseArrayIndex(Environment* env,
   return Just(true);
 }
 
+// Counterpart of ParseArrayIndex() for the arguments of fast API calls, which
+// V8 has converted to numbers already. Returns false if the index is out of
+// bounds, in which case the caller falls back to the slow path to throw.
+inline bool ParseFastArrayIndex(double arg, size_t* ret) {
+  if (!(arg >= 0) || arg > static_cast<double>(kMaxLength)) return false;
+  *ret = static_cast<size_t>(arg);
+  return true;
+}
+
+// Fast API calls may neither throw nor allocate on the JS heap, so they can
+// only read views whose contents ArrayBufferViewContents<char> can access
+// without materializing their buffer, i.e. views that have one already or
+// whose contents fit into its default stack storage of 64 bytes.
+inline bool CanReadContentsInFastCall(Local<Value> value) {
+  if (!value->IsArrayBufferView()) return false;
+  Local<ArrayBufferView> view = value.As<ArrayBufferView>();
+  return view->HasBuffer() || view->ByteLength() <= 64;
+}
+
 }  // anonymous namespace
 
 // Buffer methods
@@ -621,6 +643,287 @@ void DecodeUTF8(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(ret);
 }
 
+// Returns the length of the UTF-8 sequence that |lead| starts, or 0 if it
+// cannot start a multibyte sequence.
+inline size_t UTF8SequenceLength(uint8_t lead) {
+  if (lead >= 0xC2 && lead <= 0xDF) return 2;
+  if (lead >= 0xE0 && lead <= 0xEF) return 3;
+  if (lead >= 0xF0 && lead <= 0xF4) return 4;
+  return 0;
+}
+
+// Returns whether |byte| can follow the first |index| bytes of |seq| without
+// making the sequence invalid, following the WHATWG Encoding Standard.
+inline bool IsUTF8Continuation(const uint8_t* seq, size_t index, uint8_t byte) {
+  uint8_t lower = 0x80;
+  uint8_t upper = 0xBF;
+  if (index == 1) {
+    switch (seq[0]) {
+      case 0xE0: lower = 0xA0; break;
+      case 0xED: upper = 0x9F; break;
+      case 0xF0: lower = 0x90; break;
+      case 0xF4: upper = 0x8F; break;
+    }
+  }
+  return byte >= lower && byte <= upper;
+}
+
+// Returns the number of bytes at the end of |data| that form the valid start
+// of a UTF-8 sequence which has not been completed yet.
+size_t IncompleteUTF8SuffixLength(const uint8_t* data, size_t length) {
+  for (size_t i = 1; i <= 3 && i <= length; i++) {
+    const uint8_t* seq = data + length - i;
+    if ((seq[0] & 0xC0) == 0x80) continue;
+    if (UTF8SequenceLength(seq[0]) <= i) return 0;
+    for (size_t j = 1; j < i; j++) {
+      if (!IsUTF8Continuation(seq, j, seq[j])) return 0;
+    }
+    return i;
+  }
+  return 0;
+}
+
+// The state of a streaming decoder is kept in a Uint8Array owned by the
+// TextDecoder: the number of pending bytes, followed by the bytes of an
+// incomplete character that were left over from the previous chunk.
+constexpr size_t kDecoderPendingBytes = 0;
+constexpr size_t kDecoderPendingData = 1;
+constexpr size_t kDecoderStateSize = 4;
+
+uint8_t* GetDecoderState(Local<Value> value) {
+  CHECK(value->IsUint8Array());
+  Local<Uint8Array> array = value.As<Uint8Array>();
+  CHECK_EQ(array->ByteLength(), kDecoderStateSize);
+  return static_cast<uint8_t*>(array->Buffer()->Data()) + array->ByteOffset();
+}
+
+bool ValidateDecoderInput(Environment* env, Local<Value> input) {
+  if (input->IsArrayBuffer() || input->IsSharedArrayBuffer() ||
+      input->IsArrayBufferView()) {
+    return true;
+  }
+  THROW_ERR_INVALID_ARG_TYPE(
+      env->isolate(),
+      "The \"input\" argument must be an instance of SharedArrayBuffer, "
+      "ArrayBuffer or ArrayBufferView.");
+  return false;
+}
+
+void ReturnDecodedString(const FunctionCallbackInfo<Value>& args,
+                         MaybeLocal<String> maybe_string,
+                         Local<Value> error) {
+  Local<String> str;
+  if (!maybe_string.ToLocal(&str)) {
+    CHECK(!error.IsEmpty());
+    args.GetIsolate()->ThrowException(error);
+    return;
+  }
+  args.GetReturnValue().Set(str);
+}
+
+// Decodes the next chunk of a UTF-8 stream, without going through ICU.
+// decodeUTF8Stream(input, state, fatal, flush)
+void DecodeUTF8Stream(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  if (!ValidateDecoderInput(env, args[0])) return;
+  ArrayBufferViewContents<uint8_t> input(args[0]);
+  uint8_t* state = GetDecoderState(args[1]);
+  bool fatal = args[2]->IsTrue();
+  bool flush = args[3]->IsTrue();
+
+  const uint8_t* data = input.data();
+  size_t length = input.length();
+
+  auto invalid_data = [&]() {
+    state[kDecoderPendingBytes] = 0;
+    THROW_ERR_ENCODING_INVALID_ENCODED_DATA(
+        isolate, "The encoded data was not valid for encoding utf-8");
+  };
+
+  // Finish the character that the previous chunk ended in, if any.
+  Local<String> prefix;
+  if (state[kDecoderPendingBytes] > 0) {
+    uint8_t seq[4];
+    size_t seq_length = state[kDecoderPendingBytes];
+    memcpy(seq, state + kDecoderPendingData, seq_length);
+    const size_t needed = UTF8SequenceLength(seq[0]);
+    while (seq_length < needed && length > 0 &&
+           IsUTF8Continuation(seq, seq_length, *data)) {
+      seq[seq_length++] = *data++;
+      length--;
+    }
+
+    if (seq_length < needed && length == 0 && !flush) {
+      memcpy(state + kDecoderPendingData, seq, seq_length);
+      state[kDecoderPendingBytes] = seq_length;
+      return args.GetReturnValue().SetEmptyString();
+    }
+    state[kDecoderPendingBytes] = 0;
+
+    if (seq_length == needed) {
+      prefix = String::NewFromUtf8(isolate,
+                                   reinterpret_cast<const char*>(seq),
+                                   v8::NewStringType::kNormal,
+                                   seq_length).ToLocalChecked();
+    } else {
+      // The character was cut short, which produces a single replacement
+      // character.
+      if (fatal) return invalid_data();
+      prefix = String::NewFromUtf8Literal(isolate, "\xEF\xBF\xBD");
+    }
+  }
+
+  // Keep an incomplete character at the end for the next chunk.
+  if (!flush) {
+    const size_t suffix_length = IncompleteUTF8SuffixLength(data, length);
+    length -= suffix_length;
+    memcpy(state + kDecoderPendingData, data + length, suffix_length);
+    state[kDecoderPendingBytes] = suffix_length;
+  }
+
+  if (fatal && !simdutf::validate_utf8(reinterpret_cast<const char*>(data),
+                                       length)) {
+    return invalid_data();
+  }
+
+  Local<Value> error;
+  MaybeLocal<String> body = StringBytes::EncodeUtf8Chunk(
+      isolate, reinterpret_cast<const char*>(data), length, &error);
+  if (!prefix.IsEmpty() && !body.IsEmpty()) {
+    body = String::Concat(isolate, prefix, body.ToLocalChecked());
+  }
+  ReturnDecodedString(args, body, error);
+}
+
+// Decodes the next chunk of a UTF-16LE stream, without going through ICU.
+// decodeUTF16LEStream(input, state, fatal, flush)
+void DecodeUTF16LEStream(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  if (!ValidateDecoderInput(env, args[0])) return;
+  ArrayBufferViewContents<char> input(args[0]);
+  uint8_t* state = GetDecoderState(args[1]);
+  bool fatal = args[2]->IsTrue();
+  bool flush = args[3]->IsTrue();
+
+  // The pending bytes are an odd byte, a high surrogate, or both. Copying
+  // them and the input into one buffer also aligns the code units, which V8
+  // needs to copy them anyway.
+  const size_t pending = state[kDecoderPendingBytes];
+  const size_t byte_length = pending + input.length();
+  MaybeStackBuffer<uint16_t> units(byte_length / 2 + 1);
+  char* bytes = reinterpret_cast<char*>(units.out());
+  memcpy(bytes, state + kDecoderPendingData, pending);
+  memcpy(bytes + pending, input.data(), input.length());
+  state[kDecoderPendingBytes] = 0;
+
+  size_t length = byte_length / 2;
+  const bool odd_byte = byte_length % 2 == 1;
+  bool high_surrogate = false;
+  if (!flush && length > 0) {
+    // Compare the bytes, so that this works on big endian hosts as well.
+    high_surrogate = (static_cast<uint8_t>(bytes[length * 2 - 1]) & 0xFC) ==
+                     0xD8;
+  }
+  if (!flush && (odd_byte || high_surrogate)) {
+    const size_t kept = (high_surrogate ? 2 : 0) + (odd_byte ? 1 : 0);
+    memcpy(state + kDecoderPendingData, bytes + byte_length - kept, kept);
+    state[kDecoderPendingBytes] = kept;
+    if (high_surrogate) length--;
+  }
+
+  const char16_t* utf16 = reinterpret_cast<const char16_t*>(units.out());
+  const bool valid = simdutf::validate_utf16le(utf16, length);
+  if (fatal && (!valid || (flush && odd_byte))) {
+    state[kDecoderPendingBytes] = 0;
+    return THROW_ERR_ENCODING_INVALID_ENCODED_DATA(
+        isolate, "The encoded data was not valid for encoding utf-16le");
+  }
+
+  if (IsBigEndian()) SwapBytes16(bytes, length * 2);
+  if (!valid) {
+    // Replace unpaired surrogates, which strings could otherwise represent.
+    for (size_t i = 0; i < length; i++) {
+      if ((units[i] & 0xF800) != 0xD800) continue;
+      if (units[i] <= 0xDBFF && i + 1 < length &&
+          (units[i + 1] & 0xFC00) == 0xDC00) {
+        i++;
+      } else {
+        units[i] = 0xFFFD;
+      }
+    }
+  }
+  // A trailing odd byte produces a replacement character once flushed.
+  if (flush && odd_byte) units[length++] = 0xFFFD;
+
+  Local<Value> error;
+  MaybeLocal<String> str =
+      String::NewFromTwoByte(isolate, units.out(), v8::NewStringType::kNormal,
+                             length);
+  if (str.IsEmpty()) error = ERR_STRING_TOO_LONG(isolate);
+  ReturnDecodedString(args, str, error);
+}
+
+// The code points of the bytes 0x80 to 0x9F in windows-1252, which every
+// label of the encoding uses, including latin1 and ascii. All other bytes
+// decode to the code point with the same value.
+constexpr uint16_t kWindows1252C1[] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178};
+
+inline bool IsWindows1252C1(uint8_t byte) {
+  return byte >= 0x80 && byte <= 0x9F;
+}
+
+// Decodes windows-1252 input without going through ICU.
+// decodeWindows1252(input)
+void DecodeWindows1252(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  if (!ValidateDecoderInput(env, args[0])) return;
+  ArrayBufferViewContents<uint8_t> input(args[0]);
+  const uint8_t* bytes = input.data();
+  const size_t length = input.length();
+
+  // Input without any of the bytes that differ from Latin-1 can be copied
+  // into a one-byte string as is.
+  if (std::none_of(bytes, bytes + length, IsWindows1252C1)) {
+    Local<Value> error;
+    MaybeLocal<Value> str =
+        StringBytes::Encode(isolate,
+                            reinterpret_cast<const char*>(bytes),
+                            length,
+                            LATIN1,
+                            &error);
+    Local<Value> ret;
+    if (!str.ToLocal(&ret)) {
+      CHECK(!error.IsEmpty());
+      isolate->ThrowException(error);
+      return;
+    }
+    return args.GetReturnValue().Set(ret);
+  }
+
+  MaybeStackBuffer<uint16_t> units(length);
+  for (size_t i = 0; i < length; i++) {
+    units[i] = IsWindows1252C1(bytes[i]) ? kWindows1252C1[bytes[i] - 0x80]
+                                         : bytes[i];
+  }
+
+  Local<Value> error;
+  MaybeLocal<String> str =
+      String::NewFromTwoByte(isolate, units.out(), v8::NewStringType::kNormal,
+                             length);
+  if (str.IsEmpty()) error = ERR_STRING_TOO_LONG(isolate);
+  ReturnDecodedString(args, str, error);
+}
+
 // bytesCopied = copy(buffer, target[, targetStart][, sourceStart][, sourceEnd])
 void Copy(const FunctionCallbackInfo<Value> &args) {
   Environment* env = Environment::GetCurrent(args);
@@ -811,6 +1114,24 @@ static int normalizeCompareVal(int val, size_t a_length, size_t b_length) {
   return val;
 }
 
+int CompareOffsetImpl(const ArrayBufferViewContents<char>& source,
+                      const ArrayBufferViewContents<char>& target,
+                      size_t target_start,
+                      size_t source_start,
+                      size_t target_end,
+                      size_t source_end) {
+  size_t to_cmp =
+      std::min(std::min(source_end - source_start, target_end - target_start),
+               source.length() - source_start);
+
+  return normalizeCompareVal(to_cmp > 0 ?
+                               memcmp(source.data() + source_start,
+                                      target.data() + target_start,
+                                      to_cmp) : 0,
+                             source_end - source_start,
+                             target_end - target_start);
+}
+
 void CompareOffset(const FunctionCallbackInfo<Value> &args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -841,18 +1162,63 @@ void CompareOffset(const FunctionCallbackInfo<Value> &args) {
   CHECK_LE(source_start, source_end);
   CHECK_LE(target_start, target_end);
 
-  size_t to_cmp =
-      std::min(std::min(source_end - source_start, target_end - target_start),
-               source.length() - source_start);
+  args.GetReturnValue().Set(CompareOffsetImpl(source,
+                                              target,
+                                              target_start,
+                                              source_start,
+                                              target_end,
+                                              source_end));
+}
+
+int32_t FastCompareOffset(Local<Value> receiver,
+                          Local<Value> source_obj,
+                          Local<Value> target_obj,
+                          double target_start_arg,
+                          double source_start_arg,
+                          double target_end_arg,
+                          double source_end_arg,
+                          // NOLINTNEXTLINE(runtime/references)
+                          FastApiCallbackOptions& options) {
+  size_t target_start;
+  size_t source_start;
+  size_t target_end;
+  size_t source_end;
+  if (!CanReadContentsInFastCall(source_obj) ||
+      !CanReadContentsInFastCall(target_obj) ||
+      !ParseFastArrayIndex(target_start_arg, &target_start) ||
+      !ParseFastArrayIndex(source_start_arg, &source_start) ||
+      !ParseFastArrayIndex(target_end_arg, &target_end) ||
+      !ParseFastArrayIndex(source_end_arg, &source_end) ||
+      source_start > source_end || target_start > target_end) {
+    options.fallback = true;
+    return 0;
+  }
+
+  HandleScope scope(Isolate::GetCurrent());
+  ArrayBufferViewContents<char> source(source_obj);
+  ArrayBufferViewContents<char> target(target_obj);
+  if (source_start > source.length() || target_start > target.length()) {
+    options.fallback = true;
+    return 0;
+  }
+
+  return CompareOffsetImpl(source,
+                           target,
+                           target_start,
+                           source_start,
+                           target_end,
+                           source_end);
+}
+
+CFunction fast_compare_offset_(CFunction::Make(FastCompareOffset));
 
-  int val = normalizeCompareVal(to_cmp > 0 ?
-                                  memcmp(source.data() + source_start,
-                                         target.data() + target_start,
-                                         to_cmp) : 0,
-                                source_end - source_start,
-                                target_end - target_start);
+int CompareImpl(const ArrayBufferViewContents<char>& a,
+                const ArrayBufferViewContents<char>& b) {
+  size_t cmp_length = std::min(a.length(), b.length());
 
-  args.GetReturnValue().Set(val);
+  return normalizeCompareVal(cmp_length > 0 ?
+                               memcmp(a.data(), b.data(), cmp_length) : 0,
+                             a.length(), b.length());
 }
 
 void Compare(const FunctionCallbackInfo<Value> &args) {
@@ -863,14 +1229,28 @@ void Compare(const FunctionCallbackInfo<Value> &args) {
   ArrayBufferViewContents<char> a(args[0]);
   ArrayBufferViewContents<char> b(args[1]);
 
-  size_t cmp_length = std::min(a.length(), b.length());
+  args.GetReturnValue().Set(CompareImpl(a, b));
+}
+
+int32_t FastCompare(Local<Value> receiver,
+                    Local<Value> a_obj,
+                    Local<Value> b_obj,
+                    // NOLINTNEXTLINE(runtime/references)
+                    FastApiCallbackOptions& options) {
+  if (!CanReadContentsInFastCall(a_obj) || !CanReadContentsInFastCall(b_obj)) {
+    options.fallback = true;
+    return 0;
+  }
 
-  int val = normalizeCompareVal(cmp_length > 0 ?
-                                memcmp(a.data(), b.data(), cmp_length) : 0,
-                                a.length(), b.length());
-  args.GetReturnValue().Set(val);
+  HandleScope scope(Isolate::GetCurrent());
+  ArrayBufferViewContents<char> a(a_obj);
+  ArrayBufferViewContents<char> b(b_obj);
+
+  return CompareImpl(a, b);
 }
 
+CFunction fast_compare_(CFunction::Make(FastCompare));
+
 
 // Computes the offset for starting an indexOf or lastIndexOf search.
 // Returns either a valid offset in [0...<length - 1>], ie inside the Buffer,
@@ -1099,22 +1479,14 @@ void IndexOfBuffer(const FunctionCallbackInfo<Value>& args) {
       result == haystack_length ? -1 : static_cast<int>(result));
 }
 
-void IndexOfNumber(const FunctionCallbackInfo<Value>& args) {
-  CHECK(args[1]->IsUint32());
-  CHECK(args[2]->IsNumber());
-  CHECK(args[3]->IsBoolean());
-
-  THROW_AND_RETURN_UNLESS_BUFFER(Environment::GetCurrent(args), args[0]);
-  ArrayBufferViewContents<char> buffer(args[0]);
-
-  uint32_t needle = args[1].As<Uint32>()->Value();
-  int64_t offset_i64 = args[2].As<Integer>()->Value();
-  bool is_forward = args[3]->IsTrue();
-
+int32_t IndexOfNumberImpl(const ArrayBufferViewContents<char>& buffer,
+                          uint32_t needle,
+                          int64_t offset_i64,
+                          bool is_forward) {
   int64_t opt_offset =
       IndexOfOffset(buffer.length(), offset_i64, 1, is_forward);
   if (opt_offset <= -1 || buffer.length() == 0) {
-    return args.GetReturnValue().Set(-1);
+    return -1;
   }
   size_t offset = static_cast<size_t>(opt_offset);
   CHECK_LT(offset, buffer.length());
@@ -1126,10 +1498,47 @@ void IndexOfNumber(const FunctionCallbackInfo<Value>& args) {
     ptr = node::stringsearch::MemrchrFill(buffer.data(), needle, offset + 1);
   }
   const char* ptr_char = static_cast<const char*>(ptr);
-  args.GetReturnValue().Set(ptr ? static_cast<int>(ptr_char - buffer.data())
-                                : -1);
+  return ptr ? static_cast<int32_t>(ptr_char - buffer.data()) : -1;
+}
+
+void IndexOfNumber(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[1]->IsUint32());
+  CHECK(args[2]->IsNumber());
+  CHECK(args[3]->IsBoolean());
+
+  THROW_AND_RETURN_UNLESS_BUFFER(Environment::GetCurrent(args), args[0]);
+  ArrayBufferViewContents<char> buffer(args[0]);
+
+  uint32_t needle = args[1].As<Uint32>()->Value();
+  int64_t offset_i64 = args[2].As<Integer>()->Value();
+  bool is_forward = args[3]->IsTrue();
+
+  args.GetReturnValue().Set(
+      IndexOfNumberImpl(buffer, needle, offset_i64, is_forward));
+}
+
+int32_t FastIndexOfNumber(Local<Value> receiver,
+                          Local<Value> buffer_obj,
+                          uint32_t needle,
+                          double offset,
+                          bool is_forward,
+                          // NOLINTNEXTLINE(runtime/references)
+                          FastApiCallbackOptions& options) {
+  // The offset has been clamped to the int32 range by the caller.
+  if (!CanReadContentsInFastCall(buffer_obj) || !std::isfinite(offset)) {
+    options.fallback = true;
+    return 0;
+  }
+
+  HandleScope scope(Isolate::GetCurrent());
+  ArrayBufferViewContents<char> buffer(buffer_obj);
+
+  return IndexOfNumberImpl(
+      buffer, needle, static_cast<int64_t>(offset), is_forward);
 }
 
+CFunction fast_index_of_number_(CFunction::Make(FastIndexOfNumber));
+
 
 void Swap16(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
@@ -1253,6 +1662,52 @@ static void IsAscii(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(simdutf::validate_ascii(abv.data(), abv.length()));
 }
 
+// Shared by the fast variants of isUtf8() and isAscii(). Returns false if the
+// slow path has to be taken instead, either to throw or because the contents
+// of |value| cannot be read without allocating.
+template <bool (*validate)(const char*, size_t)>
+static bool FastValidate(Local<Value> value,
+                         // NOLINTNEXTLINE(runtime/references)
+                         FastApiCallbackOptions& options) {
+  if (value->IsArrayBuffer()) {
+    Local<ArrayBuffer> ab = value.As<ArrayBuffer>();
+    if (ab->WasDetached()) {
+      options.fallback = true;
+      return false;
+    }
+    return validate(static_cast<const char*>(ab->Data()), ab->ByteLength());
+  }
+  if (value->IsSharedArrayBuffer()) {
+    Local<SharedArrayBuffer> sab = value.As<SharedArrayBuffer>();
+    return validate(static_cast<const char*>(sab->Data()), sab->ByteLength());
+  }
+  if (!value->IsTypedArray() || !CanReadContentsInFastCall(value)) {
+    options.fallback = true;
+    return false;
+  }
+
+  HandleScope scope(Isolate::GetCurrent());
+  ArrayBufferViewContents<char> abv(value);
+  return validate(abv.data(), abv.length());
+}
+
+static bool FastIsUtf8(Local<Value> receiver,
+                       Local<Value> value,
+                       // NOLINTNEXTLINE(runtime/references)
+                       FastApiCallbackOptions& options) {
+  return FastValidate<simdutf::validate_utf8>(value, options);
+}
+
+static bool FastIsAscii(Local<Value> receiver,
+                        Local<Value> value,
+                        // NOLINTNEXTLINE(runtime/references)
+                        FastApiCallbackOptions& options) {
+  return FastValidate<simdutf::validate_ascii>(value, options);
+}
+
+static CFunction fast_is_utf8_(CFunction::Make(FastIsUtf8));
+static CFunction fast_is_ascii_(CFunction::Make(FastIsAscii));
+
 void SetBufferPrototype(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -1367,14 +1822,21 @@ void Initialize(Local<Object> target,
   SetMethod(context, target, "setBufferPrototype", SetBufferPrototype);
   SetMethodNoSideEffect(context, target, "createFromString", CreateFromString);
   SetMethodNoSideEffect(context, target, "decodeUTF8", DecodeUTF8);
+  SetMethod(context, target, "decodeUTF8Stream", DecodeUTF8Stream);
+  SetMethod(context, target, "decodeUTF16LEStream", DecodeUTF16LEStream);
+  SetMethodNoSideEffect(
+      context, target, "decodeWindows1252", DecodeWindows1252);
 
   SetMethodNoSideEffect(context, target, "byteLengthUtf8", ByteLengthUtf8);
   SetMethod(context, target, "copy", Copy);
-  SetMethodNoSideEffect(context, target, "compare", Compare);
-  SetMethodNoSideEffect(context, target, "compareOffset", CompareOffset);
+  SetFastMethodNoSideEffect(
+      context, target, "compare", Compare, &fast_compare_);
+  SetFastMethodNoSideEffect(
+      context, target, "compareOffset", CompareOffset, &fast_compare_offset_);
   SetMethod(context, target, "fill", Fill);
   SetMethodNoSideEffect(context, target, "indexOfBuffer", IndexOfBuffer);
-  SetMethodNoSideEffect(context, target, "indexOfNumber", IndexOfNumber);
+  SetFastMethodNoSideEffect(
+      context, target, "indexOfNumber", IndexOfNumber, &fast_index_of_number_);
   SetMethodNoSideEffect(context, target, "indexOfString", IndexOfString);
 
   SetMethod(context, target, "detachArrayBuffer", DetachArrayBuffer);
@@ -1387,8 +1849,10 @@ void Initialize(Local<Object> target,
   SetMethod(context, target, "encodeInto", EncodeInto);
   SetMethodNoSideEffect(context, target, "encodeUtf8String", EncodeUtf8String);
 
-  SetMethodNoSideEffect(context, target, "isUtf8", IsUtf8);
-  SetMethodNoSideEffect(context, target, "isAscii", IsAscii);
+  SetFastMethodNoSideEffect(
+      context, target, "isUtf8", IsUtf8, &fast_is_utf8_);
+  SetFastMethodNoSideEffect(
+      context, target, "isAscii", IsAscii, &fast_is_ascii_);
 
   target
       ->Set(context,
@@ -1428,14 +1892,17 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(SetBufferPrototype);
   registry->Register(CreateFromString);
   registry->Register(DecodeUTF8);
+  registry->Register(DecodeUTF8Stream);
+  registry->Register(DecodeUTF16LEStream);
+  registry->Register(DecodeWindows1252);
 
   registry->Register(ByteLengthUtf8);
   registry->Register(Copy);
-  registry->Register(Compare);
-  registry->Register(CompareOffset);
+  registry->RegisterFastMethod(Compare, &fast_compare_);
+  registry->RegisterFastMethod(CompareOffset, &fast_compare_offset_);
   registry->Register(Fill);
   registry->Register(IndexOfBuffer);
-  registry->Register(IndexOfNumber);
+  registry->RegisterFastMethod(IndexOfNumber, &fast_index_of_number_);
   registry->Register(IndexOfString);
 
   registry->Register(Swap16);
@@ -1445,8 +1912,8 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(EncodeInto);
   registry->Register(EncodeUtf8String);
 
-  registry->Register(IsUtf8);
-  registry->Register(IsAscii);
+  registry->RegisterFastMethod(IsUtf8, &fast_is_utf8_);
+  registry->RegisterFastMethod(IsAscii, &fast_is_ascii_);
 
   registry->Register(StringSlice<ASCII>);
   registry->Register(StringSlice<BASE64>);
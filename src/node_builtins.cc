@@ -339,9 +339,20 @@ MaybeLocal<Function> BuiltinLoader::LookupAndCompileInternal(
                                                                : "is accepted");
   }
 
-  // Generate new cache for next compilation
-  std::unique_ptr<ScriptCompiler::CachedData> new_cached_data(
-      ScriptCompiler::CreateCodeCacheForFunction(fun));
+  // Keep the cache for the next compilation, e.g. in another realm or in a
+  // worker. An accepted cache that references the snapshot data can be used
+  // again as is, otherwise a new one has to be generated.
+  std::unique_ptr<ScriptCompiler::CachedData> new_cached_data;
+  const ScriptCompiler::CachedData* consumed = script_source.GetCachedData();
+  if (*result == Result::kWithCache &&
+      consumed->buffer_policy == ScriptCompiler::CachedData::BufferNotOwned) {
+    new_cached_data = std::make_unique<ScriptCompiler::CachedData>(
+        consumed->data,
+        consumed->length,
+        ScriptCompiler::CachedData::BufferNotOwned);
+  } else {
+    new_cached_data.reset(ScriptCompiler::CreateCodeCacheForFunction(fun));
+  }
   CHECK_NOT_NULL(new_cached_data);
 
   {
@@ -520,11 +531,12 @@ void BuiltinLoader::CopyCodeCache(std::vector<CodeCacheInfo>* out) const {
 void BuiltinLoader::RefreshCodeCache(const std::vector<CodeCacheInfo>& in) {
   RwLock::ScopedLock lock(code_cache_->mutex);
   for (auto const& item : in) {
-    size_t length = item.data.size();
-    uint8_t* buffer = new uint8_t[length];
-    memcpy(buffer, item.data.data(), length);
+    // Reference the code cache instead of copying it, so that the pages of
+    // the built-ins that are never compiled are not touched at all.
     auto new_cache = std::make_unique<v8::ScriptCompiler::CachedData>(
-        buffer, length, v8::ScriptCompiler::CachedData::BufferOwned);
+        item.bytes(),
+        static_cast<int>(item.size()),
+        v8::ScriptCompiler::CachedData::BufferNotOwned);
     code_cache_->map[item.id] = std::move(new_cache);
   }
   code_cache_->has_code_cache = true;
@@ -33,6 +33,17 @@ using BuiltinCodeCacheMap =
 struct CodeCacheInfo {
   std::string id;
   std::vector<uint8_t> data;
+  // The code cache of the snapshot embedded into the binary is not copied
+  // into `data`, but read from the read-only data section of the binary.
+  const uint8_t* external_data = nullptr;
+  size_t external_size = 0;
+
+  const uint8_t* bytes() const {
+    return external_data != nullptr ? external_data : data.data();
+  }
+  size_t size() const {
+    return external_data != nullptr ? external_size : data.size();
+  }
 };
 
 // Handles compilation and caching of built-in JavaScript modules and
@@ -75,6 +86,8 @@ class NODE_EXTERN_PRIVATE BuiltinLoader {
   bool Add(const char* id, std::string_view utf8source);
 
   bool CompileAllBuiltins(v8::Local<v8::Context> context);
+  // The code cache is referenced, not copied, so `in` must outlive the
+  // loader and all the loaders it is shared with.
   void RefreshCodeCache(const std::vector<CodeCacheInfo>& in);
   void CopyCodeCache(std::vector<CodeCacheInfo>* out) const;
 
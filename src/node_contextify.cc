@@ -48,6 +48,7 @@ using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::IndexedPropertyHandlerConfiguration;
 using v8::Int32;
+using v8::Integer;
 using v8::Isolate;
 using v8::Just;
 using v8::Local;
@@ -1189,12 +1190,22 @@ void ContextifyContext::CompileFunction(
     params_buf = args[8].As<Array>();
   }
 
+  // Argument 10: whether to use the compile cache (optional)
+  CompileCacheEntry* cache_entry = nullptr;
+  if (args[9]->IsTrue() && env->use_compile_cache() &&
+      cached_data_buf.IsEmpty()) {
+    cache_entry = env->compile_cache_handler()->GetOrInsert(
+        code, filename, CachedCodeType::kCommonJS);
+  }
+
   // Read cache from cached data buffer
   ScriptCompiler::CachedData* cached_data = nullptr;
   if (!cached_data_buf.IsEmpty()) {
     uint8_t* data = static_cast<uint8_t*>(cached_data_buf->Buffer()->Data());
     cached_data = new ScriptCompiler::CachedData(
       data + cached_data_buf->ByteOffset(), cached_data_buf->ByteLength());
+  } else if (cache_entry != nullptr && cache_entry->cache != nullptr) {
+    cached_data = cache_entry->CopyCache();
   }
 
   // Get the function id
@@ -1282,6 +1293,14 @@ void ContextifyContext::CompileFunction(
   CompiledFnEntry* entry = new CompiledFnEntry(env, cache_key, id, fn);
   env->id_to_function_map.emplace(id, entry);
 
+  if (cache_entry != nullptr) {
+    bool rejected = options == ScriptCompiler::kConsumeCodeCache &&
+                    source.GetCachedData()->rejected;
+    env->compile_cache_handler()->MaybeSave(cache_entry, fn, rejected);
+    // The outcome is reported through the compile cache statistics instead.
+    options = ScriptCompiler::kNoCompileOptions;
+  }
+
   Local<Object> result = Object::New(isolate);
   if (result->Set(parsing_context, env->function_string(), fn).IsNothing())
     return;
@@ -1369,6 +1388,31 @@ static void MeasureMemory(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(promise);
 }
 
+// Returns [directory, hits, misses, rejected, written], or undefined if the
+// compile cache is not enabled.
+static void GetCompileCacheStats(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  if (!env->use_compile_cache()) return;
+  CompileCacheHandler* handler = env->compile_cache_handler();
+  const CompileCacheStats& stats = handler->stats();
+  Local<Value> dir;
+  if (!ToV8Value(env->context(), handler->cache_dir()).ToLocal(&dir)) return;
+  Local<Value> values[] = {
+      dir,
+      Integer::NewFromUnsigned(env->isolate(), stats.hits),
+      Integer::NewFromUnsigned(env->isolate(), stats.misses),
+      Integer::NewFromUnsigned(env->isolate(), stats.rejected),
+      Integer::NewFromUnsigned(env->isolate(), stats.written),
+  };
+  args.GetReturnValue().Set(
+      Array::New(env->isolate(), values, arraysize(values)));
+}
+
+static void FlushCompileCache(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  env->FlushCompileCache();
+}
+
 MicrotaskQueueWrap::MicrotaskQueueWrap(Environment* env, Local<Object> obj)
   : BaseObject(env, obj),
     microtask_queue_(
@@ -1453,6 +1497,9 @@ void Initialize(Local<Object> target,
   target->Set(context, env->constants_string(), constants).Check();
 
   SetMethod(context, target, "measureMemory", MeasureMemory);
+  SetMethodNoSideEffect(
+      context, target, "getCompileCacheStats", GetCompileCacheStats);
+  SetMethod(context, target, "flushCompileCache", FlushCompileCache);
 }
 
 void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
@@ -1464,6 +1511,8 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(StopSigintWatchdog);
   registry->Register(WatchdogHasPendingSigint);
   registry->Register(MeasureMemory);
+  registry->Register(GetCompileCacheStats);
+  registry->Register(FlushCompileCache);
 }
 }  // namespace contextify
 }  // namespace node
@@ -37,6 +37,7 @@ using v8::Value;
 namespace crypto {
 
 #define CRYPTO_NAMESPACE_LIST_BASE(V)                                          \
+  V(AEADContext)                                                               \
   V(AES)                                                                       \
   V(CipherBase)                                                                \
   V(DiffieHellman)                                                             \
@@ -42,6 +42,16 @@ class ExternalReferenceRegistry {
   ALLOWED_EXTERNAL_REFERENCE_TYPES(V)
 #undef V
 
+  // Registers a method with a V8 fast API variant: the slow callback, as well
+  // as the address and the type information of the fast one. This keeps the
+  // signatures of fast callbacks out of the list of allowed types above.
+  void RegisterFastMethod(v8::FunctionCallback slow_callback,
+                          const v8::CFunction* c_function) {
+    Register(slow_callback);
+    RegisterT(c_function->GetAddress());
+    Register(c_function->GetTypeInfo());
+  }
+
   // This can be called only once.
   const std::vector<intptr_t>& external_references();
 
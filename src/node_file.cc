@@ -26,6 +26,7 @@
 #include "node_external_reference.h"
 #include "node_process-inl.h"
 #include "node_stat_watcher.h"
+#include "package_json_parser.h"
 #include "util-inl.h"
 
 #include "tracing/trace_event.h"
@@ -997,11 +998,32 @@ void Close(const FunctionCallbackInfo<Value>& args) {
 }
 
 
-// Used to speed up module loading. Returns an array [string, boolean]
+static Local<Value> ToV8Value(Isolate* isolate,
+                              const std::optional<std::string>& value) {
+  if (!value.has_value()) return Undefined(isolate);
+  return String::NewFromUtf8(isolate,
+                             value->data(),
+                             v8::NewStringType::kNormal,
+                             value->size())
+      .ToLocalChecked();
+}
+
+static Local<Value> ToV8Value(Isolate* isolate, std::string_view value) {
+  if (value.empty()) return Undefined(isolate);
+  return String::NewFromUtf8(
+             isolate, value.data(), v8::NewStringType::kNormal, value.size())
+      .ToLocalChecked();
+}
+
+// Used to speed up module loading. Returns an empty array if the file cannot
+// be read. Otherwise, if the file is a JSON object, returns an array
+// [string, boolean, name, main, exports, imports, type] where the string is
+// only included if args[1] is true, and exports and imports are the JSON text
+// of their values. If it is not, returns an array [string, boolean] so that
+// the JSON.parse() error can be reported.
 static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
   Isolate* isolate = env->isolate();
-  uv_loop_t* loop = env->event_loop();
 
   CHECK(args[0]->IsString());
   node::Utf8Value path(isolate, args[0]);
@@ -1010,43 +1032,17 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
     args.GetReturnValue().Set(Array::New(isolate));
     return;  // Contains a nul byte.
   }
-  uv_fs_t open_req;
-  const int fd = uv_fs_open(loop, &open_req, *path, O_RDONLY, 0, nullptr);
-  uv_fs_req_cleanup(&open_req);
-
-  if (fd < 0) {
+  std::string chars;
+  ResolutionCache* cache = env->resolution_cache();
+  const bool found =
+      cache != nullptr
+          ? cache->ReadPackageJSON(*path, &chars)
+          : ResolutionCache::ReadFileUncached(*path, &chars, nullptr) == 0;
+  if (!found) {
     args.GetReturnValue().Set(Array::New(isolate));
     return;
   }
-
-  auto defer_close = OnScopeLeave([fd, loop]() {
-    uv_fs_t close_req;
-    CHECK_EQ(0, uv_fs_close(loop, &close_req, fd, nullptr));
-    uv_fs_req_cleanup(&close_req);
-  });
-
-  const size_t kBlockSize = 32 << 10;
-  std::vector<char> chars;
-  int64_t offset = 0;
-  ssize_t numchars;
-  do {
-    const size_t start = chars.size();
-    chars.resize(start + kBlockSize);
-
-    uv_buf_t buf;
-    buf.base = &chars[start];
-    buf.len = kBlockSize;
-
-    uv_fs_t read_req;
-    numchars = uv_fs_read(loop, &read_req, fd, &buf, 1, offset, nullptr);
-    uv_fs_req_cleanup(&read_req);
-
-    if (numchars < 0) {
-      args.GetReturnValue().Set(Array::New(isolate));
-      return;
-    }
-    offset += numchars;
-  } while (static_cast<size_t>(numchars) == kBlockSize);
+  const size_t offset = chars.size();
 
   size_t start = 0;
   if (offset >= 3 && 0 == memcmp(chars.data(), "\xEF\xBB\xBF", 3)) {
@@ -1082,12 +1078,37 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
     }
   }
 
-  Local<Value> return_value[] = {
-      String::NewFromUtf8(
-          isolate, &chars[start], v8::NewStringType::kNormal, size)
-          .ToLocalChecked(),
-      Boolean::New(isolate, p < pe ? true : false)};
+  const bool contains_keys = p < pe;
+  PackageJSONFields fields;
+  const bool parsed =
+      ParsePackageJSON(std::string_view(&chars[start], size), &fields);
 
+  Local<Value> source;
+  if (!parsed || args[1]->IsTrue()) {
+    source = String::NewFromUtf8(
+                 isolate, &chars[start], v8::NewStringType::kNormal, size)
+                 .ToLocalChecked();
+  } else {
+    source = Undefined(isolate);
+  }
+
+  if (!parsed) {
+    Local<Value> return_value[] = {source,
+                                   Boolean::New(isolate, contains_keys)};
+    args.GetReturnValue().Set(
+        Array::New(isolate, return_value, arraysize(return_value)));
+    return;
+  }
+
+  Local<Value> return_value[] = {
+      source,
+      Boolean::New(isolate, contains_keys),
+      ToV8Value(isolate, fields.name),
+      ToV8Value(isolate, fields.main),
+      ToV8Value(isolate, fields.exports),
+      ToV8Value(isolate, fields.imports),
+      ToV8Value(isolate, fields.type),
+  };
   args.GetReturnValue().Set(
       Array::New(isolate, return_value, arraysize(return_value)));
 }
@@ -1101,6 +1122,12 @@ static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[0]->IsString());
   node::Utf8Value path(env->isolate(), args[0]);
 
+  ResolutionCache* cache = env->resolution_cache();
+  if (cache != nullptr) {
+    args.GetReturnValue().Set(cache->Stat(*path));
+    return;
+  }
+
   uv_fs_t req;
   int rc = uv_fs_stat(env->event_loop(), &req, *path, nullptr);
   if (rc == 0) {
@@ -1112,6 +1139,11 @@ static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(rc);
 }
 
+static void FlushResolutionCache(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  env->FlushResolutionCache();
+}
+
 static void Stat(const FunctionCallbackInfo<Value>& args) {
   BindingData* binding_data = Realm::GetBindingData<BindingData>(args);
   Environment* env = binding_data->env();
@@ -2704,6 +2736,7 @@ void Initialize(Local<Object> target,
   SetMethod(context, target, "readdir", ReadDir);
   SetMethod(context, target, "internalModuleReadJSON", InternalModuleReadJSON);
   SetMethod(context, target, "internalModuleStat", InternalModuleStat);
+  SetMethod(context, target, "flushResolutionCache", FlushResolutionCache);
   SetMethod(context, target, "stat", Stat);
   SetMethod(context, target, "lstat", LStat);
   SetMethod(context, target, "fstat", FStat);
@@ -2817,6 +2850,7 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   registry->Register(ReadDir);
   registry->Register(InternalModuleReadJSON);
   registry->Register(InternalModuleStat);
+  registry->Register(FlushResolutionCache);
   registry->Register(Stat);
   registry->Register(LStat);
   registry->Register(FStat);
@@ -24,6 +24,7 @@
 
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
+#include "array_buffer_pool.h"
 #include "env.h"
 #include "node.h"
 #include "node_binding.h"
@@ -102,6 +103,8 @@ v8::Maybe<bool> InitializePrimordials(v8::Local<v8::Context> context);
 
 class NodeArrayBufferAllocator : public ArrayBufferAllocator {
  public:
+  NodeArrayBufferAllocator();
+
   inline uint32_t* zero_fill_field() { return &zero_fill_field_; }
 
   void* Allocate(size_t size) override;  // Defined in src/node.cc
@@ -119,6 +122,8 @@ class NodeArrayBufferAllocator : public ArrayBufferAllocator {
   inline uint64_t total_mem_usage() const {
     return total_mem_usage_.load(std::memory_order_relaxed);
   }
+  // Only set when --array-buffer-pool-size is used.
+  inline const ArrayBufferPool* pool() const { return pool_.get(); }
 
  private:
   uint32_t zero_fill_field_ = 1;  // Boolean but exposed as uint32 to JS land.
@@ -127,6 +132,8 @@ class NodeArrayBufferAllocator : public ArrayBufferAllocator {
   // Delegate to V8's allocator for compatibility with the V8 memory cage.
   std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_{
       v8::ArrayBuffer::Allocator::NewDefaultAllocator()};
+  // Declared after allocator_, which it returns its blocks to when destroyed.
+  std::unique_ptr<ArrayBufferPool> pool_;
 };
 
 class DebuggingArrayBufferAllocator final : public NodeArrayBufferAllocator {
@@ -360,6 +367,13 @@ int WriteFileSync(const char* path, uv_buf_t buf);
 int WriteFileSync(v8::Isolate* isolate,
                   const char* path,
                   v8::Local<v8::String> string);
+// Writes |contents| to |path| through a temporary file that is renamed into
+// place. Returns 0 on success or a libuv error code.
+int WriteFileSyncAtomically(const std::string& path,
+                            const std::string& contents,
+                            uint64_t thread_id);
+// Returns the CRC-32 checksum of |size| bytes at |data|.
+uint32_t GetCrc32(const char* data, size_t size);
 
 class DiagnosticFilename {
  public:
@@ -91,6 +91,9 @@ void PerProcessOptions::CheckOptions(std::vector<std::string>* errors,
   }
 #endif  // HAVE_OPENSSL
 
+  if (array_buffer_pool_size < 0)
+    errors->push_back("--array-buffer-pool-size must not be negative");
+
   if (use_largepages != "off" &&
       use_largepages != "on" &&
       use_largepages != "silent") {
@@ -843,6 +846,11 @@ PerProcessOptionsParser::PerProcessOptionsParser(
             "", /* undocumented, only for debugging */
             &PerProcessOptions::debug_arraybuffer_allocations,
             kAllowedInEnvvar);
+  AddOption("--array-buffer-pool-size",
+            "maximum number of bytes of freed ArrayBuffer memory that each "
+            "thread keeps for reuse (default: 0, disabled)",
+            &PerProcessOptions::array_buffer_pool_size,
+            kAllowedInEnvvar);
   AddOption("--disable-proto",
             "disable Object.prototype.__proto__",
             &PerProcessOptions::disable_proto,
@@ -250,6 +250,7 @@ class PerProcessOptions : public Options {
   int64_t v8_thread_pool_size = 4;
   bool zero_fill_all_buffers = false;
   bool debug_arraybuffer_allocations = false;
+  int64_t array_buffer_pool_size = 0;
   std::string disable_proto;
   bool build_snapshot = false;
   // We enable the shared read-only heap which currently requires that the
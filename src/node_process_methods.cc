@@ -482,12 +482,8 @@ void BindingData::AddMethods() {
 
 void BindingData::RegisterExternalReferences(
     ExternalReferenceRegistry* registry) {
-  registry->Register(SlowNumber);
-  registry->Register(SlowBigInt);
-  registry->Register(FastNumber);
-  registry->Register(FastBigInt);
-  registry->Register(fast_number_.GetTypeInfo());
-  registry->Register(fast_bigint_.GetTypeInfo());
+  registry->RegisterFastMethod(SlowNumber, &fast_number_);
+  registry->RegisterFastMethod(SlowBigInt, &fast_bigint_);
 }
 
 BindingData* BindingData::FromV8Value(Local<Value> value) {
@@ -76,6 +76,7 @@ static void PrintJavaScriptErrorProperties(JSONWriter* writer,
 static void PrintNativeStack(JSONWriter* writer);
 static void PrintResourceUsage(JSONWriter* writer);
 static void PrintGCStatistics(JSONWriter* writer, Isolate* isolate);
+static void PrintArrayBufferPool(JSONWriter* writer, Environment* env);
 static void PrintSystemInformation(JSONWriter* writer);
 static void PrintLoadedLibraries(JSONWriter* writer);
 static void PrintComponentVersions(JSONWriter* writer);
@@ -194,6 +195,9 @@ static void WriteNodeReport(Isolate* isolate,
   // Report native stack backtrace
   PrintNativeStack(&writer);
 
+  // Report the reuse of ArrayBuffer memory, if enabled
+  if (env != nullptr) PrintArrayBufferPool(&writer, env);
+
   // Report OS and current thread resource usage
   PrintResourceUsage(&writer);
 
@@ -623,6 +627,26 @@ static void PrintGCStatistics(JSONWriter* writer, Isolate* isolate) {
   writer->json_objectend();
 }
 
+static void PrintArrayBufferPool(JSONWriter* writer, Environment* env) {
+  NodeArrayBufferAllocator* allocator = env->isolate_data()->node_allocator();
+  if (allocator == nullptr || allocator->pool() == nullptr) return;
+  const ArrayBufferPool* pool = allocator->pool();
+
+  writer->json_objectstart("arrayBufferPool");
+  writer->json_keyvalue("maxCachedMemory", pool->max_cached_bytes());
+  writer->json_arraystart("sizeClasses");
+  for (const ArrayBufferPool::SizeClassStats& stats : pool->GetStats()) {
+    writer->json_start();
+    writer->json_keyvalue("blockSize", stats.block_size);
+    writer->json_keyvalue("hits", stats.hits);
+    writer->json_keyvalue("misses", stats.misses);
+    writer->json_keyvalue("cachedBlocks", stats.cached_blocks);
+    writer->json_end();
+  }
+  writer->json_arrayend();
+  writer->json_objectend();
+}
+
 static void PrintResourceUsage(JSONWriter* writer) {
   // Get process uptime in seconds
   uint64_t uptime =
@@ -2,6 +2,7 @@
 #include "node_snapshotable.h"
 #include <iostream>
 #include <sstream>
+#include <string_view>
 #include <vector>
 #include "base_object-inl.h"
 #include "blob_serializer_deserializer-inl.h"
@@ -50,7 +51,7 @@ const uint32_t SnapshotData::kMagic;
 std::ostream& operator<<(std::ostream& output,
                          const builtins::CodeCacheInfo& info) {
   output << "<builtins::CodeCacheInfo id=" << info.id
-         << ", size=" << info.data.size() << ">\n";
+         << ", size=" << info.size() << ">\n";
   return output;
 }
 
@@ -185,7 +186,7 @@ class SnapshotSerializerDeserializer {
 
 class SnapshotDeserializer : public SnapshotSerializerDeserializer {
  public:
-  explicit SnapshotDeserializer(const std::vector<char>& s)
+  explicit SnapshotDeserializer(std::string_view s)
       : SnapshotSerializerDeserializer(), sink(s) {}
   ~SnapshotDeserializer() {}
 
@@ -211,6 +212,11 @@ class SnapshotDeserializer : public SnapshotSerializerDeserializer {
     if (count == 0) {
       return std::vector<T>();
     }
+    // Every element takes up at least one byte.
+    if (count > remaining() / (std::is_arithmetic_v<T> ? sizeof(T) : 1)) {
+      is_malformed = true;
+      return std::vector<T>();
+    }
     if (is_debug) {
       Debug("Reading %d vector elements...\n", count);
     }
@@ -230,7 +236,11 @@ class SnapshotDeserializer : public SnapshotSerializerDeserializer {
       Debug("ReadString(), length=%d: ", length);
     }
 
-    CHECK_GT(length, 0);  // There should be no empty strings.
+    // There should be no empty strings.
+    if (length == 0 || length >= remaining()) {
+      is_malformed = true;
+      return std::string();
+    }
     MallocedBuffer<char> buf(length + 1);
     memcpy(buf.data, sink.data() + read_total, length + 1);
     std::string result(buf.data, length);  // This creates a copy of buf.data.
@@ -243,8 +253,14 @@ class SnapshotDeserializer : public SnapshotSerializerDeserializer {
     return result;
   }
 
+  size_t remaining() const { return sink.size() - read_total; }
+
   size_t read_total = 0;
-  const std::vector<char>& sink;
+  std::string_view sink;
+  // Set when a read goes past the end of the sink or finds a value that
+  // cannot have been written by SnapshotSerializer. The reads that follow
+  // return empty values.
+  bool is_malformed = false;
 
  private:
   // Helper for reading an array of numeric types.
@@ -257,6 +273,11 @@ class SnapshotDeserializer : public SnapshotSerializerDeserializer {
       Debug("Read<%s>()(%d-byte), count=%d: ", name.c_str(), sizeof(T), count);
     }
 
+    if (is_malformed || count > remaining() / sizeof(T)) {
+      is_malformed = true;
+      memset(out, 0, sizeof(T) * count);
+      return;
+    }
     size_t size = sizeof(T) * count;
     memcpy(out, sink.data() + read_total, size);
 
@@ -292,6 +313,7 @@ class SnapshotDeserializer : public SnapshotSerializerDeserializer {
         Debug("\n[%d] ", i);
       }
       result.push_back(Read<T>());
+      if (is_malformed) break;
     }
     is_debug = original_is_debug;
 
@@ -442,7 +464,11 @@ v8::StartupData SnapshotDeserializer::Read() {
   int raw_size = Read<int>();
   Debug("size=%d\n", raw_size);
 
-  CHECK_GT(raw_size, 0);  // There should be no startup data of size 0.
+  // There should be no startup data of size 0.
+  if (raw_size <= 0 || static_cast<size_t>(raw_size) > remaining()) {
+    is_malformed = true;
+    return v8::StartupData{nullptr, 0};
+  }
   // The data pointer of v8::StartupData would be deleted so it must be new'ed.
   std::unique_ptr<char> buf = std::unique_ptr<char>(new char[raw_size]);
   Read<char>(buf.get(), raw_size);
@@ -485,10 +511,15 @@ size_t SnapshotSerializer::Write(const builtins::CodeCacheInfo& data) {
   Debug("\nWrite<builtins::CodeCacheInfo>() id = %s"
         ", size=%d\n",
         data.id.c_str(),
-        data.data.size());
+        data.size());
 
+  // Same layout as WriteVector<uint8_t>(), which cannot be used for the
+  // code cache of the embedded snapshot.
   size_t written_total = WriteString(data.id);
-  written_total += WriteVector<uint8_t>(data.data);
+  written_total += Write<size_t>(data.size());
+  if (data.size() > 0) {
+    written_total += Write(data.bytes(), data.size());
+  }
 
   Debug("Write<builtins::CodeCacheInfo>() wrote %d bytes\n", written_total);
   return written_total;
@@ -875,17 +906,36 @@ bool SnapshotData::FromBlob(SnapshotData* out, FILE* in) {
   size_t num_read = fread(sink.data(), size, 1, in);
   CHECK_EQ(num_read, 1);
 
-  SnapshotDeserializer r(sink);
+  return FromBlob(out, std::string_view(sink.data(), sink.size()));
+}
+
+bool SnapshotData::FromBlob(SnapshotData* out, std::string_view in) {
+  SnapshotDeserializer r(in);
   r.Debug("SnapshotData::FromBlob()\n");
 
   DCHECK_EQ(out->data_ownership, SnapshotData::DataOwnership::kOwned);
 
   // Metadata
+  // Blobs passed in by embedders have not necessarily been written by
+  // ToBlob(), so reject them instead of crashing.
+  if (in.size() < sizeof(uint32_t)) {
+    fprintf(stderr, "Failed to load the startup snapshot: blob is empty.\n");
+    return false;
+  }
   uint32_t magic = r.Read<uint32_t>();
   r.Debug("Read magic %" PRIx32 "\n", magic);
-  CHECK_EQ(magic, kMagic);
+  if (magic != kMagic) {
+    fprintf(stderr,
+            "Failed to load the startup snapshot: not a snapshot blob.\n");
+    return false;
+  }
   out->metadata = r.Read<SnapshotMetadata>();
   r.Debug("Read metadata\n");
+  if (r.is_malformed) {
+    fprintf(stderr,
+            "Failed to load the startup snapshot: blob is malformed.\n");
+    return false;
+  }
   if (!out->Check()) {
     return false;
   }
@@ -896,6 +946,11 @@ bool SnapshotData::FromBlob(SnapshotData* out, FILE* in) {
   out->env_info = r.Read<EnvSerializeInfo>();
   r.Debug("Read code_cache\n");
   out->code_cache = r.ReadVector<builtins::CodeCacheInfo>();
+  if (r.is_malformed) {
+    fprintf(stderr,
+            "Failed to load the startup snapshot: blob is malformed.\n");
+    return false;
+  }
 
   r.Debug("SnapshotData::FromBlob() read %d bytes\n", r.read_total);
   return true;
@@ -989,16 +1044,18 @@ static std::string FormatSize(size_t size) {
 static void WriteStaticCodeCacheData(std::ostream* ss,
                                      const builtins::CodeCacheInfo& info) {
   *ss << "static const uint8_t " << GetCodeCacheDefName(info.id) << "[] = {\n";
-  WriteVector(ss, info.data.data(), info.data.size());
+  WriteVector(ss, info.bytes(), info.size());
   *ss << "};";
 }
 
 static void WriteCodeCacheInitializer(std::ostream* ss, const std::string& id) {
   std::string def_name = GetCodeCacheDefName(id);
+  // Reference the static array instead of copying it into a vector, so that
+  // the code cache stays in the read-only data section.
   *ss << "    { \"" << id << "\",\n";
-  *ss << "      {" << def_name << ",\n";
-  *ss << "       " << def_name << " + arraysize(" << def_name << "),\n";
-  *ss << "      }\n";
+  *ss << "      {},\n";
+  *ss << "      " << def_name << ",\n";
+  *ss << "      arraysize(" << def_name << "),\n";
   *ss << "    },\n";
 }
 
@@ -1236,7 +1293,7 @@ int SnapshotBuilder::Generate(SnapshotData* out,
       }
       env->builtin_loader()->CopyCodeCache(&(out->code_cache));
       for (const auto& item : out->code_cache) {
-        std::string size_str = FormatSize(item.data.size());
+        std::string size_str = FormatSize(item.size());
         per_process::Debug(DebugCategory::MKSNAPSHOT,
                            "Generated code cache for %d: %s\n",
                            item.id.c_str(),
@@ -2,6 +2,7 @@
 #include "node.h"
 #include "node_external_reference.h"
 
+using v8::CFunction;
 using v8::Context;
 using v8::FunctionCallbackInfo;
 using v8::Local;
@@ -39,49 +40,83 @@ namespace {
   V(ModuleNamespaceObject)                                                    \
 
 
-#define V(type) \
+#define V(type)                                                               \
   static void Is##type(const FunctionCallbackInfo<Value>& args) {             \
     args.GetReturnValue().Set(args[0]->Is##type());                           \
-  }
+  }                                                                           \
+  static bool Is##type##FastApi(Local<Value> receiver, Local<Value> value) {  \
+    return value->Is##type();                                                 \
+  }                                                                           \
+  static CFunction fast_is_##type##_(CFunction::Make(Is##type##FastApi));
 
   VALUE_METHOD_MAP(V)
 #undef V
 
+static bool IsAnyArrayBufferImpl(Local<Value> value) {
+  return value->IsArrayBuffer() || value->IsSharedArrayBuffer();
+}
+
 static void IsAnyArrayBuffer(const FunctionCallbackInfo<Value>& args) {
-  args.GetReturnValue().Set(
-    args[0]->IsArrayBuffer() || args[0]->IsSharedArrayBuffer());
+  args.GetReturnValue().Set(IsAnyArrayBufferImpl(args[0]));
+}
+
+static bool IsAnyArrayBufferFastApi(Local<Value> receiver, Local<Value> value) {
+  return IsAnyArrayBufferImpl(value);
+}
+
+static CFunction fast_is_any_array_buffer_(
+    CFunction::Make(IsAnyArrayBufferFastApi));
+
+static bool IsBoxedPrimitiveImpl(Local<Value> value) {
+  return value->IsNumberObject() ||
+         value->IsStringObject() ||
+         value->IsBooleanObject() ||
+         value->IsBigIntObject() ||
+         value->IsSymbolObject();
 }
 
 static void IsBoxedPrimitive(const FunctionCallbackInfo<Value>& args) {
-  args.GetReturnValue().Set(
-    args[0]->IsNumberObject() ||
-    args[0]->IsStringObject() ||
-    args[0]->IsBooleanObject() ||
-    args[0]->IsBigIntObject() ||
-    args[0]->IsSymbolObject());
+  args.GetReturnValue().Set(IsBoxedPrimitiveImpl(args[0]));
 }
 
+static bool IsBoxedPrimitiveFastApi(Local<Value> receiver, Local<Value> value) {
+  return IsBoxedPrimitiveImpl(value);
+}
+
+static CFunction fast_is_boxed_primitive_(
+    CFunction::Make(IsBoxedPrimitiveFastApi));
+
 void InitializeTypes(Local<Object> target,
                      Local<Value> unused,
                      Local<Context> context,
                      void* priv) {
-#define V(type) SetMethodNoSideEffect(context, target, "is" #type, Is##type);
+#define V(type)                                                               \
+  SetFastMethodNoSideEffect(                                                  \
+      context, target, "is" #type, Is##type, &fast_is_##type##_);
   VALUE_METHOD_MAP(V)
 #undef V
 
-  SetMethodNoSideEffect(context, target, "isAnyArrayBuffer", IsAnyArrayBuffer);
-  SetMethodNoSideEffect(context, target, "isBoxedPrimitive", IsBoxedPrimitive);
+  SetFastMethodNoSideEffect(context,
+                            target,
+                            "isAnyArrayBuffer",
+                            IsAnyArrayBuffer,
+                            &fast_is_any_array_buffer_);
+  SetFastMethodNoSideEffect(context,
+                            target,
+                            "isBoxedPrimitive",
+                            IsBoxedPrimitive,
+                            &fast_is_boxed_primitive_);
 }
 
 }  // anonymous namespace
 
 void RegisterTypesExternalReferences(ExternalReferenceRegistry* registry) {
-#define V(type) registry->Register(Is##type);
+#define V(type) registry->RegisterFastMethod(Is##type, &fast_is_##type##_);
   VALUE_METHOD_MAP(V)
 #undef V
 
-  registry->Register(IsAnyArrayBuffer);
-  registry->Register(IsBoxedPrimitive);
+  registry->RegisterFastMethod(IsAnyArrayBuffer, &fast_is_any_array_buffer_);
+  registry->RegisterFastMethod(IsBoxedPrimitive, &fast_is_boxed_primitive_);
 }
 }  // namespace node
 
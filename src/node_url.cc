@@ -14,6 +14,7 @@
 namespace node {
 namespace url {
 
+using v8::Array;
 using v8::Context;
 using v8::FunctionCallbackInfo;
 using v8::HandleScope;
@@ -118,31 +119,26 @@ void BindingData::DomainToUnicode(const FunctionCallbackInfo<Value>& args) {
                                 .ToLocalChecked());
 }
 
-// TODO(@anonrig): Add V8 Fast API for CanParse method
+// There is no V8 Fast API variant of this method, because V8 10.2 cannot pass
+// strings to fast calls, and reading their contents from a fast call could
+// require flattening them, which allocates on the JS heap.
 void BindingData::CanParse(const FunctionCallbackInfo<Value>& args) {
   CHECK_GE(args.Length(), 1);
   CHECK(args[0]->IsString());  // input
   // args[1] // base url
 
-  Environment* env = Environment::GetCurrent(args);
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
-
-  Utf8Value input(env->isolate(), args[0]);
-  ada::result<ada::url_aggregator> base;
-  ada::url_aggregator* base_pointer = nullptr;
+  Isolate* isolate = args.GetIsolate();
+  Utf8Value input(isolate, args[0]);
+  bool can_parse;
   if (args[1]->IsString()) {
-    base = ada::parse<ada::url_aggregator>(
-        Utf8Value(env->isolate(), args[1]).ToString());
-    if (!base) {
-      return args.GetReturnValue().Set(false);
-    }
-    base_pointer = &base.value();
+    Utf8Value base(isolate, args[1]);
+    std::string_view base_view = base.ToStringView();
+    can_parse = ada::can_parse(input.ToStringView(), &base_view);
+  } else {
+    can_parse = ada::can_parse(input.ToStringView());
   }
-  auto out =
-      ada::parse<ada::url_aggregator>(input.ToStringView(), base_pointer);
 
-  args.GetReturnValue().Set(out.has_value());
+  args.GetReturnValue().Set(can_parse);
 }
 
 void BindingData::Format(const FunctionCallbackInfo<Value>& args) {
@@ -195,16 +191,14 @@ void BindingData::Parse(const FunctionCallbackInfo<Value>& args) {
   // args[1] // base url
 
   BindingData* binding_data = Realm::GetBindingData<BindingData>(args);
-  Environment* env = Environment::GetCurrent(args);
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
+  Isolate* isolate = args.GetIsolate();
 
-  Utf8Value input(env->isolate(), args[0]);
+  Utf8Value input(isolate, args[0]);
   ada::result<ada::url_aggregator> base;
   ada::url_aggregator* base_pointer = nullptr;
   if (args[1]->IsString()) {
     base = ada::parse<ada::url_aggregator>(
-        Utf8Value(env->isolate(), args[1]).ToString());
+        Utf8Value(isolate, args[1]).ToStringView());
     if (!base) {
       return args.GetReturnValue().Set(false);
     }
@@ -219,9 +213,89 @@ void BindingData::Parse(const FunctionCallbackInfo<Value>& args) {
 
   binding_data->UpdateComponents(out->get_components(), out->type);
 
-  args.GetReturnValue().Set(
-      ToV8Value(env->context(), out->get_href(), env->isolate())
-          .ToLocalChecked());
+  Local<Value> href;
+  if (ToV8Value(isolate->GetCurrentContext(), out->get_href(), isolate)
+          .ToLocal(&href)) {
+    args.GetReturnValue().Set(href);
+  }
+}
+
+// Parses an application/x-www-form-urlencoded string into a flat array of
+// alternating names and values, which is how URLSearchParams stores them.
+void BindingData::ParseSearchParams(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsString());  // query string
+
+  Isolate* isolate = args.GetIsolate();
+  Local<Context> context = isolate->GetCurrentContext();
+  Utf8Value input(isolate, args[0]);
+  ada::url_search_params params(input.ToStringView());
+
+  std::vector<Local<Value>> result;
+  result.reserve(params.size() * 2);
+  for (const auto& [name, value] : params) {
+    Local<Value> name_string;
+    Local<Value> value_string;
+    if (!ToV8Value(context, name, isolate).ToLocal(&name_string) ||
+        !ToV8Value(context, value, isolate).ToLocal(&value_string)) {
+      return;
+    }
+    result.push_back(name_string);
+    result.push_back(value_string);
+  }
+
+  args.GetReturnValue().Set(Array::New(isolate, result.data(), result.size()));
+}
+
+namespace {
+
+// Appends |input| encoded with the application/x-www-form-urlencoded byte
+// serializer, which leaves only ASCII alphanumerics and *-._ untouched and
+// turns spaces into '+'.
+void AppendFormURLEncoded(std::string_view input, std::string* out) {
+  static constexpr char kHexDigits[] = "0123456789ABCDEF";
+  for (const char c : input) {
+    const unsigned char byte = c;
+    if ((byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') ||
+        (byte >= '0' && byte <= '9') || byte == '*' || byte == '-' ||
+        byte == '.' || byte == '_') {
+      out->push_back(c);
+    } else if (byte == ' ') {
+      out->push_back('+');
+    } else {
+      out->push_back('%');
+      out->push_back(kHexDigits[byte >> 4]);
+      out->push_back(kHexDigits[byte & 0xf]);
+    }
+  }
+}
+
+}  // anonymous namespace
+
+// Serializes a flat array of alternating names and values back into an
+// application/x-www-form-urlencoded string.
+void BindingData::SerializeSearchParams(
+    const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsArray());  // names and values
+
+  Isolate* isolate = args.GetIsolate();
+  Local<Context> context = isolate->GetCurrentContext();
+  Local<Array> array = args[0].As<Array>();
+  const uint32_t length = array->Length();
+  CHECK_EQ(length % 2, 0);
+
+  std::string result;
+  for (uint32_t i = 0; i < length; i++) {
+    Local<Value> entry;
+    if (!array->Get(context, i).ToLocal(&entry)) return;
+    CHECK(entry->IsString());
+    if (i > 0) result.push_back(i % 2 == 0 ? '&' : '=');
+    AppendFormURLEncoded(Utf8Value(isolate, entry).ToStringView(), &result);
+  }
+
+  Local<Value> ret;
+  if (ToV8Value(context, result, isolate).ToLocal(&ret)) {
+    args.GetReturnValue().Set(ret);
+  }
 }
 
 void BindingData::Update(const FunctionCallbackInfo<Value>& args) {
@@ -352,6 +426,10 @@ void BindingData::Initialize(Local<Object> target,
   SetMethodNoSideEffect(context, target, "canParse", CanParse);
   SetMethodNoSideEffect(context, target, "format", Format);
   SetMethod(context, target, "parse", Parse);
+  SetMethodNoSideEffect(
+      context, target, "parseSearchParams", ParseSearchParams);
+  SetMethodNoSideEffect(
+      context, target, "serializeSearchParams", SerializeSearchParams);
   SetMethod(context, target, "update", Update);
 }
 
@@ -364,6 +442,8 @@ void BindingData::RegisterExternalReferences(
   registry->Register(CanParse);
   registry->Register(Format);
   registry->Register(Parse);
+  registry->Register(ParseSearchParams);
+  registry->Register(SerializeSearchParams);
   registry->Register(Update);
 }
 
@@ -52,6 +52,10 @@ class BindingData : public SnapshotableObject {
   static void CanParse(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Format(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Parse(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void ParseSearchParams(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SerializeSearchParams(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Update(const v8::FunctionCallbackInfo<v8::Value>& args);
 
   static void Initialize(v8::Local<v8::Object> target,
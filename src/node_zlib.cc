@@ -24,8 +24,10 @@
 #include "node_buffer.h"
 
 #include "async_wrap-inl.h"
+#include "base_object-inl.h"
 #include "env-inl.h"
 #include "node_external_reference.h"
+#include "node_messaging.h"
 #include "threadpoolwork-inl.h"
 #include "util-inl.h"
 
@@ -35,6 +37,14 @@
 #include "brotli/decode.h"
 #include "zlib.h"
 
+#if HAVE_ZSTD
+// ZSTD_createCCtx_advanced() and ZSTD_createDCtx_advanced() are needed to
+// route zstd's allocations through the memory tracking below.
+#define ZSTD_STATIC_LINKING_ONLY
+#include "zstd.h"
+#include "zstd_errors.h"
+#endif
+
 #include <sys/types.h>
 
 #include <cerrno>
@@ -51,10 +61,13 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Int32;
+using v8::Int32Array;
 using v8::Integer;
 using v8::Isolate;
 using v8::Local;
+using v8::Number;
 using v8::Object;
+using v8::Uint32;
 using v8::Uint32Array;
 using v8::Value;
 
@@ -104,7 +117,9 @@ enum node_zlib_mode {
   INFLATERAW,
   UNZIP,
   BROTLI_DECODE,
-  BROTLI_ENCODE
+  BROTLI_ENCODE,
+  ZSTD_COMPRESS,
+  ZSTD_DECOMPRESS
 };
 
 constexpr uint8_t GZIP_HEADER_ID1 = 0x1f;
@@ -127,6 +142,79 @@ struct CompressionError {
   inline bool IsError() const { return code != nullptr; }
 };
 
+// Dictionary bytes are immutable once created, so streams and threads can
+// share them without copying.
+using ZlibDictionaryData = std::shared_ptr<const std::vector<unsigned char>>;
+
+// A preset dictionary that is copied out of JS land once, and can then be
+// handed to any number of zlib streams, including streams on other threads
+// (it is cloneable through postMessage()).
+class ZlibDictionary final : public BaseObject {
+ public:
+  static Local<FunctionTemplate> GetConstructorTemplate(Environment* env);
+  static bool HasInstance(Environment* env, Local<Value> value);
+  static BaseObjectPtr<ZlibDictionary> Create(Environment* env,
+                                              ZlibDictionaryData data);
+
+  // new ZlibDictionary(buffer)
+  static void New(const FunctionCallbackInfo<Value>& args);
+
+  ZlibDictionary(Environment* env, Local<Object> wrap, ZlibDictionaryData data)
+      : BaseObject(env, wrap), data_(std::move(data)) {
+    MakeWeak();
+    Isolate* isolate = env->isolate();
+    uLong id = adler32(0L, Z_NULL, 0);
+    id = adler32_z(id, data_->data(), data_->size());
+    wrap->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(isolate, "id"),
+              Integer::NewFromUnsigned(isolate, static_cast<uint32_t>(id)))
+        .Check();
+    wrap->Set(env->context(),
+              FIXED_ONE_BYTE_STRING(isolate, "size"),
+              Number::New(isolate, static_cast<double>(data_->size())))
+        .Check();
+  }
+
+  inline const ZlibDictionaryData& data() const { return data_; }
+
+  void MemoryInfo(MemoryTracker* tracker) const override {
+    tracker->TrackFieldWithSize("data", data_->size());
+  }
+  SET_MEMORY_INFO_NAME(ZlibDictionary)
+  SET_SELF_SIZE(ZlibDictionary)
+
+  TransferMode GetTransferMode() const override {
+    return TransferMode::kCloneable;
+  }
+  std::unique_ptr<worker::TransferData> CloneForMessaging() const override {
+    return std::make_unique<TransferData>(data_);
+  }
+
+  class TransferData : public worker::TransferData {
+   public:
+    explicit TransferData(ZlibDictionaryData data) : data_(std::move(data)) {}
+
+    BaseObjectPtr<BaseObject> Deserialize(
+        Environment* env,
+        Local<Context> context,
+        std::unique_ptr<worker::TransferData> self) override {
+      return Create(env, std::move(data_));
+    }
+
+    void MemoryInfo(MemoryTracker* tracker) const override {
+      tracker->TrackFieldWithSize("data", data_->size());
+    }
+    SET_MEMORY_INFO_NAME(ZlibDictionary::TransferData)
+    SET_SELF_SIZE(TransferData)
+
+   private:
+    ZlibDictionaryData data_;
+  };
+
+ private:
+  ZlibDictionaryData data_;
+};
+
 class ZlibContext final : public MemoryRetainer {
  public:
   ZlibContext() = default;
@@ -143,7 +231,7 @@ class ZlibContext final : public MemoryRetainer {
 
   // Zlib-specific:
   void Init(int level, int window_bits, int mem_level, int strategy,
-            std::vector<unsigned char>&& dictionary);
+            ZlibDictionaryData dictionary);
   void SetAllocationFunctions(alloc_func alloc, free_func free, void* opaque);
   CompressionError SetParams(int level, int strategy);
 
@@ -151,7 +239,9 @@ class ZlibContext final : public MemoryRetainer {
   SET_SELF_SIZE(ZlibContext)
 
   void MemoryInfo(MemoryTracker* tracker) const override {
-    tracker->TrackField("dictionary", dictionary_);
+    // Shared dictionaries are accounted for by their ZlibDictionary owner.
+    if (dictionary_ && dictionary_.use_count() == 1)
+      tracker->TrackFieldWithSize("dictionary", dictionary_->size());
   }
 
   ZlibContext(const ZlibContext&) = delete;
@@ -172,7 +262,7 @@ class ZlibContext final : public MemoryRetainer {
   int strategy_ = 0;
   int window_bits_ = 0;
   unsigned int gzip_id_bytes_read_ = 0;
-  std::vector<unsigned char> dictionary_;
+  ZlibDictionaryData dictionary_;
 
   z_stream strm_;
 };
@@ -248,6 +338,76 @@ class BrotliDecoderContext final : public BrotliContext {
   DeleteFnPtr<BrotliDecoderState, BrotliDecoderDestroyInstance> state_;
 };
 
+#if HAVE_ZSTD
+// Like Brotli, zstd uses different types for compression and decompression,
+// so the shared streaming state lives in this base class.
+class ZstdContext : public MemoryRetainer {
+ public:
+  ZstdContext() = default;
+
+  void SetBuffers(const char* in, uint32_t in_len, char* out, uint32_t out_len);
+  void SetFlush(int flush);
+  void GetAfterWriteOffsets(uint32_t* avail_in, uint32_t* avail_out) const;
+  inline void SetMode(node_zlib_mode mode) { mode_ = mode; }
+
+  ZstdContext(const ZstdContext&) = delete;
+  ZstdContext& operator=(const ZstdContext&) = delete;
+
+ protected:
+  node_zlib_mode mode_ = NONE;
+  ZSTD_inBuffer input_ = {nullptr, 0, 0};
+  ZSTD_outBuffer output_ = {nullptr, 0, 0};
+  ZSTD_EndDirective flush_ = ZSTD_e_continue;
+  // The return value of the last zstd streaming call: either an error code,
+  // or a hint about how much more work there is to do.
+  size_t last_result_ = 0;
+  ZSTD_customMem mem_ = ZSTD_defaultCMem;
+};
+
+inline void FreeZstdCCtx(ZSTD_CCtx* cctx) {
+  ZSTD_freeCCtx(cctx);
+}
+
+inline void FreeZstdDCtx(ZSTD_DCtx* dctx) {
+  ZSTD_freeDCtx(dctx);
+}
+
+class ZstdCompressContext final : public ZstdContext {
+ public:
+  void Close();
+  void DoThreadPoolWork();
+  CompressionError Init(ZSTD_customMem mem, uint64_t pledged_src_size);
+  CompressionError ResetStream();
+  CompressionError SetParams(int key, int value);
+  CompressionError GetErrorInfo() const;
+
+  SET_MEMORY_INFO_NAME(ZstdCompressContext)
+  SET_SELF_SIZE(ZstdCompressContext)
+  SET_NO_MEMORY_INFO()  // cctx_ is covered through allocation tracking.
+
+ private:
+  uint64_t pledged_src_size_ = ZSTD_CONTENTSIZE_UNKNOWN;
+  DeleteFnPtr<ZSTD_CCtx, FreeZstdCCtx> cctx_;
+};
+
+class ZstdDecompressContext final : public ZstdContext {
+ public:
+  void Close();
+  void DoThreadPoolWork();
+  CompressionError Init(ZSTD_customMem mem, uint64_t pledged_src_size);
+  CompressionError ResetStream();
+  CompressionError SetParams(int key, int value);
+  CompressionError GetErrorInfo() const;
+
+  SET_MEMORY_INFO_NAME(ZstdDecompressContext)
+  SET_SELF_SIZE(ZstdDecompressContext)
+  SET_NO_MEMORY_INFO()  // dctx_ is covered through allocation tracking.
+
+ private:
+  DeleteFnPtr<ZSTD_DCtx, FreeZstdDCtx> dctx_;
+};
+#endif  // HAVE_ZSTD
+
 template <typename CompressionContext>
 class CompressionStream : public AsyncWrap, public ThreadPoolWork {
  public:
@@ -611,13 +771,18 @@ class ZlibStream final : public CompressionStream<ZlibContext> {
     CHECK(args[5]->IsFunction());
     Local<Function> write_js_callback = args[5].As<Function>();
 
-    std::vector<unsigned char> dictionary;
+    ZlibDictionaryData dictionary;
     if (Buffer::HasInstance(args[6])) {
       unsigned char* data =
           reinterpret_cast<unsigned char*>(Buffer::Data(args[6]));
-      dictionary = std::vector<unsigned char>(
+      dictionary = std::make_shared<const std::vector<unsigned char>>(
           data,
           data + Buffer::Length(args[6]));
+    } else if (ZlibDictionary::HasInstance(Environment::GetCurrent(args),
+                                           args[6])) {
+      ZlibDictionary* dict;
+      ASSIGN_OR_RETURN_UNWRAP(&dict, args[6]);
+      dictionary = dict->data();
     }
 
     wrap->InitStream(write_result, write_js_callback);
@@ -729,11 +894,98 @@ class BrotliCompressionStream final :
 using BrotliEncoderStream = BrotliCompressionStream<BrotliEncoderContext>;
 using BrotliDecoderStream = BrotliCompressionStream<BrotliDecoderContext>;
 
+#if HAVE_ZSTD
+template <typename CompressionContext>
+class ZstdCompressionStream final :
+  public CompressionStream<CompressionContext> {
+ public:
+  ZstdCompressionStream(Environment* env,
+                        Local<Object> wrap,
+                        node_zlib_mode mode)
+    : CompressionStream<CompressionContext>(env, wrap) {
+    context()->SetMode(mode);
+  }
+
+  inline CompressionContext* context() {
+    return this->CompressionStream<CompressionContext>::context();
+  }
+  typedef typename CompressionStream<CompressionContext>::AllocScope AllocScope;
+
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    CHECK(args[0]->IsInt32());
+    node_zlib_mode mode =
+        static_cast<node_zlib_mode>(args[0].As<Int32>()->Value());
+    new ZstdCompressionStream(env, args.This(), mode);
+  }
+
+  // init(params, pledgedSrcSize, writeResult, writeCallback)
+  // params is an Int32Array of (key, value) pairs.
+  static void Init(const FunctionCallbackInfo<Value>& args) {
+    ZstdCompressionStream* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+    CHECK(args.Length() == 4 &&
+          "init(params, pledgedSrcSize, writeResult, writeCallback)");
+
+    uint64_t pledged_src_size = ZSTD_CONTENTSIZE_UNKNOWN;
+    if (args[1]->IsNumber()) {
+      double value = args[1].As<Number>()->Value();
+      if (value >= 0) pledged_src_size = static_cast<uint64_t>(value);
+    }
+
+    CHECK(args[2]->IsUint32Array());
+    uint32_t* write_result = reinterpret_cast<uint32_t*>(Buffer::Data(args[2]));
+
+    CHECK(args[3]->IsFunction());
+    Local<Function> write_js_callback = args[3].As<Function>();
+    wrap->InitStream(write_result, write_js_callback);
+
+    AllocScope alloc_scope(wrap);
+    ZSTD_customMem mem = {
+        CompressionStream<CompressionContext>::AllocForBrotli,
+        CompressionStream<CompressionContext>::FreeForZlib,
+        static_cast<CompressionStream<CompressionContext>*>(wrap)};
+    CompressionError err = wrap->context()->Init(mem, pledged_src_size);
+    if (err.IsError()) {
+      wrap->EmitError(err);
+      args.GetReturnValue().Set(false);
+      return;
+    }
+
+    CHECK(args[0]->IsInt32Array());
+    const int32_t* data = reinterpret_cast<int32_t*>(Buffer::Data(args[0]));
+    size_t len = args[0].As<Int32Array>()->Length();
+    CHECK_EQ(len % 2, 0);
+
+    for (size_t i = 0; i < len; i += 2) {
+      err = wrap->context()->SetParams(data[i], data[i + 1]);
+      if (err.IsError()) {
+        wrap->EmitError(err);
+        args.GetReturnValue().Set(false);
+        return;
+      }
+    }
+
+    args.GetReturnValue().Set(true);
+  }
+
+  static void Params(const FunctionCallbackInfo<Value>& args) {
+    // Currently a no-op, and not accessed from JS land.
+  }
+
+  SET_MEMORY_INFO_NAME(ZstdCompressionStream)
+  SET_SELF_SIZE(ZstdCompressionStream)
+};
+
+using ZstdCompressStream = ZstdCompressionStream<ZstdCompressContext>;
+using ZstdDecompressStream = ZstdCompressionStream<ZstdDecompressContext>;
+#endif  // HAVE_ZSTD
+
 void ZlibContext::Close() {
   {
     Mutex::ScopedLock lock(mutex_);
     if (!zlib_init_done_) {
-      dictionary_.clear();
+      dictionary_.reset();
       mode_ = NONE;
       return;
     }
@@ -752,7 +1004,7 @@ void ZlibContext::Close() {
   CHECK(status == Z_OK || status == Z_DATA_ERROR);
   mode_ = NONE;
 
-  dictionary_.clear();
+  dictionary_.reset();
 }
 
 
@@ -827,11 +1079,11 @@ void ZlibContext::DoThreadPoolWork() {
       // SetDictionary, don't repeat that here)
       if (mode_ != INFLATERAW &&
           err_ == Z_NEED_DICT &&
-          !dictionary_.empty()) {
+          dictionary_ && !dictionary_->empty()) {
         // Load it
         err_ = inflateSetDictionary(&strm_,
-                                    dictionary_.data(),
-                                    dictionary_.size());
+                                    dictionary_->data(),
+                                    dictionary_->size());
         if (err_ == Z_OK) {
           // And try to decode again
           err_ = inflate(&strm_, flush_);
@@ -903,7 +1155,7 @@ CompressionError ZlibContext::GetErrorInfo() const {
     // normal statuses, not fatal
     break;
   case Z_NEED_DICT:
-    if (dictionary_.empty())
+    if (!dictionary_ || dictionary_->empty())
       return ErrorForMessage("Missing dictionary");
     else
       return ErrorForMessage("Bad dictionary");
@@ -957,7 +1209,7 @@ void ZlibContext::SetAllocationFunctions(alloc_func alloc,
 
 void ZlibContext::Init(
     int level, int window_bits, int mem_level, int strategy,
-    std::vector<unsigned char>&& dictionary) {
+    ZlibDictionaryData dictionary) {
   if (!((window_bits == 0) &&
         (mode_ == INFLATE ||
          mode_ == GUNZIP ||
@@ -1030,7 +1282,7 @@ bool ZlibContext::InitZlib() {
   }
 
   if (err_ != Z_OK) {
-    dictionary_.clear();
+    dictionary_.reset();
     mode_ = NONE;
     return true;
   }
@@ -1042,7 +1294,7 @@ bool ZlibContext::InitZlib() {
 
 
 CompressionError ZlibContext::SetDictionary() {
-  if (dictionary_.empty())
+  if (!dictionary_ || dictionary_->empty())
     return CompressionError {};
 
   err_ = Z_OK;
@@ -1051,15 +1303,15 @@ CompressionError ZlibContext::SetDictionary() {
     case DEFLATE:
     case DEFLATERAW:
       err_ = deflateSetDictionary(&strm_,
-                                  dictionary_.data(),
-                                  dictionary_.size());
+                                  dictionary_->data(),
+                                  dictionary_->size());
       break;
     case INFLATERAW:
       // The other inflate cases will have the dictionary set when inflate()
       // returns Z_NEED_DICT in Process()
       err_ = inflateSetDictionary(&strm_,
-                                  dictionary_.data(),
-                                  dictionary_.size());
+                                  dictionary_->data(),
+                                  dictionary_->size());
       break;
     default:
       break;
@@ -1252,6 +1504,154 @@ CompressionError BrotliDecoderContext::GetErrorInfo() const {
   }
 }
 
+#if HAVE_ZSTD
+void ZstdContext::SetBuffers(const char* in, uint32_t in_len,
+                             char* out, uint32_t out_len) {
+  input_ = {in, in_len, 0};
+  output_ = {out, out_len, 0};
+}
+
+
+void ZstdContext::SetFlush(int flush) {
+  flush_ = static_cast<ZSTD_EndDirective>(flush);
+}
+
+
+void ZstdContext::GetAfterWriteOffsets(uint32_t* avail_in,
+                                       uint32_t* avail_out) const {
+  *avail_in = input_.size - input_.pos;
+  *avail_out = output_.size - output_.pos;
+}
+
+
+void ZstdCompressContext::DoThreadPoolWork() {
+  CHECK_EQ(mode_, ZSTD_COMPRESS);
+  CHECK(cctx_);
+  last_result_ = ZSTD_compressStream2(cctx_.get(), &output_, &input_, flush_);
+}
+
+
+void ZstdCompressContext::Close() {
+  cctx_.reset();
+  mode_ = NONE;
+}
+
+CompressionError ZstdCompressContext::Init(ZSTD_customMem mem,
+                                           uint64_t pledged_src_size) {
+  mem_ = mem;
+  pledged_src_size_ = pledged_src_size;
+  cctx_.reset(ZSTD_createCCtx_advanced(mem));
+  if (!cctx_) {
+    return CompressionError("Could not initialize zstd instance",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+  if (ZSTD_isError(
+          ZSTD_CCtx_setPledgedSrcSize(cctx_.get(), pledged_src_size))) {
+    return CompressionError("Could not set pledged source size",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+  return CompressionError {};
+}
+
+CompressionError ZstdCompressContext::ResetStream() {
+  // Resetting the session keeps the parameters, unlike re-initializing.
+  last_result_ = 0;
+  if (ZSTD_isError(ZSTD_CCtx_reset(cctx_.get(), ZSTD_reset_session_only)) ||
+      ZSTD_isError(
+          ZSTD_CCtx_setPledgedSrcSize(cctx_.get(), pledged_src_size_))) {
+    return CompressionError("Could not reset zstd instance",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+  return CompressionError {};
+}
+
+CompressionError ZstdCompressContext::SetParams(int key, int value) {
+  if (ZSTD_isError(ZSTD_CCtx_setParameter(
+          cctx_.get(), static_cast<ZSTD_cParameter>(key), value))) {
+    return CompressionError("Setting parameter failed",
+                            "ERR_ZSTD_PARAM_SET_FAILED",
+                            -1);
+  } else {
+    return CompressionError {};
+  }
+}
+
+CompressionError ZstdCompressContext::GetErrorInfo() const {
+  if (ZSTD_isError(last_result_)) {
+    return CompressionError(ZSTD_getErrorName(last_result_),
+                            "ERR_ZSTD_COMPRESSION_FAILED",
+                            static_cast<int>(ZSTD_getErrorCode(last_result_)));
+  } else {
+    return CompressionError {};
+  }
+}
+
+
+void ZstdDecompressContext::Close() {
+  dctx_.reset();
+  mode_ = NONE;
+}
+
+void ZstdDecompressContext::DoThreadPoolWork() {
+  CHECK_EQ(mode_, ZSTD_DECOMPRESS);
+  CHECK(dctx_);
+  last_result_ = ZSTD_decompressStream(dctx_.get(), &output_, &input_);
+}
+
+CompressionError ZstdDecompressContext::Init(ZSTD_customMem mem,
+                                             uint64_t pledged_src_size) {
+  mem_ = mem;
+  dctx_.reset(ZSTD_createDCtx_advanced(mem));
+  if (!dctx_) {
+    return CompressionError("Could not initialize zstd instance",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+  return CompressionError {};
+}
+
+CompressionError ZstdDecompressContext::ResetStream() {
+  last_result_ = 0;
+  if (ZSTD_isError(ZSTD_DCtx_reset(dctx_.get(), ZSTD_reset_session_only))) {
+    return CompressionError("Could not reset zstd instance",
+                            "ERR_ZLIB_INITIALIZATION_FAILED",
+                            -1);
+  }
+  return CompressionError {};
+}
+
+CompressionError ZstdDecompressContext::SetParams(int key, int value) {
+  if (ZSTD_isError(ZSTD_DCtx_setParameter(
+          dctx_.get(), static_cast<ZSTD_dParameter>(key), value))) {
+    return CompressionError("Setting parameter failed",
+                            "ERR_ZSTD_PARAM_SET_FAILED",
+                            -1);
+  } else {
+    return CompressionError {};
+  }
+}
+
+CompressionError ZstdDecompressContext::GetErrorInfo() const {
+  if (ZSTD_isError(last_result_)) {
+    return CompressionError(ZSTD_getErrorName(last_result_),
+                            "ERR_ZSTD_DECOMPRESSION_FAILED",
+                            static_cast<int>(ZSTD_getErrorCode(last_result_)));
+  } else if (flush_ == ZSTD_e_end && last_result_ != 0 &&
+             input_.pos == input_.size && output_.pos < output_.size) {
+    // zstd still expects input for the current frame. Match zlib's
+    // behaviour, as zstd doesn't have its own code for this.
+    return CompressionError("unexpected end of file",
+                            "Z_BUF_ERROR",
+                            Z_BUF_ERROR);
+  } else {
+    return CompressionError {};
+  }
+}
+#endif  // HAVE_ZSTD
+
 
 template <typename Stream>
 struct MakeClass {
@@ -1285,6 +1685,66 @@ struct MakeClass {
   }
 };
 
+Local<FunctionTemplate> ZlibDictionary::GetConstructorTemplate(
+    Environment* env) {
+  Local<FunctionTemplate> tmpl = env->zlib_dictionary_constructor_template();
+  if (tmpl.IsEmpty()) {
+    Isolate* isolate = env->isolate();
+    tmpl = NewFunctionTemplate(isolate, New);
+    tmpl->SetClassName(FIXED_ONE_BYTE_STRING(isolate, "Dictionary"));
+    tmpl->Inherit(BaseObject::GetConstructorTemplate(env));
+    tmpl->InstanceTemplate()->SetInternalFieldCount(
+        ZlibDictionary::kInternalFieldCount);
+    env->set_zlib_dictionary_constructor_template(tmpl);
+  }
+  return tmpl;
+}
+
+bool ZlibDictionary::HasInstance(Environment* env, Local<Value> value) {
+  return GetConstructorTemplate(env)->HasInstance(value);
+}
+
+BaseObjectPtr<ZlibDictionary> ZlibDictionary::Create(Environment* env,
+                                                     ZlibDictionaryData data) {
+  Local<Object> obj;
+  if (!GetConstructorTemplate(env)
+           ->InstanceTemplate()
+           ->NewInstance(env->context())
+           .ToLocal(&obj)) {
+    return BaseObjectPtr<ZlibDictionary>();
+  }
+  return MakeBaseObject<ZlibDictionary>(env, obj, std::move(data));
+}
+
+void ZlibDictionary::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsArrayBufferView());
+  Environment* env = Environment::GetCurrent(args);
+  ArrayBufferViewContents<unsigned char> contents(args[0]);
+  new ZlibDictionary(
+      env,
+      args.This(),
+      std::make_shared<const std::vector<unsigned char>>(
+          contents.data(), contents.data() + contents.length()));
+}
+
+// crc32(data, value) computes the CRC-32 of a string or ArrayBufferView,
+// continuing from a previous checksum value.
+void CRC32(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsArrayBufferView() || args[0]->IsString());
+  CHECK(args[1]->IsUint32());
+  uint32_t value = args[1].As<Uint32>()->Value();
+  if (args[0]->IsArrayBufferView()) {
+    ArrayBufferViewContents<Bytef> data(args[0]);
+    value = crc32_z(value, data.data(), data.length());
+  } else {
+    Utf8Value data(args.GetIsolate(), args[0]);
+    value = crc32_z(
+        value, reinterpret_cast<const Bytef*>(*data), data.length());
+  }
+  args.GetReturnValue().Set(value);
+}
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -1294,6 +1754,23 @@ void Initialize(Local<Object> target,
   MakeClass<ZlibStream>::Make(env, target, "Zlib");
   MakeClass<BrotliEncoderStream>::Make(env, target, "BrotliEncoder");
   MakeClass<BrotliDecoderStream>::Make(env, target, "BrotliDecoder");
+#if HAVE_ZSTD
+  MakeClass<ZstdCompressStream>::Make(env, target, "ZstdCompress");
+  MakeClass<ZstdDecompressStream>::Make(env, target, "ZstdDecompress");
+#endif
+
+  SetConstructorFunction(context,
+                         target,
+                         "Dictionary",
+                         ZlibDictionary::GetConstructorTemplate(env),
+                         SetConstructorFunctionFlag::NONE);
+
+  SetMethod(context, target, "crc32", CRC32);
+
+  // By zlib convention, crc32(0, NULL, 0) runs the CPU feature detection
+  // that selects the SIMD CRC-32 kernels. Otherwise crc32() calls that happen
+  // before the first deflateInit()/inflateInit() use the portable code.
+  crc32(0L, Z_NULL, 0);
 
   target->Set(env->context(),
               FIXED_ONE_BYTE_STRING(env->isolate(), "ZLIB_VERSION"),
@@ -1304,6 +1781,12 @@ void RegisterExternalReferences(ExternalReferenceRegistry* registry) {
   MakeClass<ZlibStream>::Make(registry);
   MakeClass<BrotliEncoderStream>::Make(registry);
   MakeClass<BrotliDecoderStream>::Make(registry);
+#if HAVE_ZSTD
+  MakeClass<ZstdCompressStream>::Make(registry);
+  MakeClass<ZstdDecompressStream>::Make(registry);
+#endif
+  registry->Register(ZlibDictionary::New);
+  registry->Register(CRC32);
 }
 
 }  // anonymous namespace
@@ -1347,6 +1830,8 @@ void DefineZlibConstants(Local<Object> target) {
   NODE_DEFINE_CONSTANT(target, UNZIP);
   NODE_DEFINE_CONSTANT(target, BROTLI_DECODE);
   NODE_DEFINE_CONSTANT(target, BROTLI_ENCODE);
+  NODE_DEFINE_CONSTANT(target, ZSTD_COMPRESS);
+  NODE_DEFINE_CONSTANT(target, ZSTD_DECOMPRESS);
 
   NODE_DEFINE_CONSTANT(target, Z_MIN_WINDOWBITS);
   NODE_DEFINE_CONSTANT(target, Z_MAX_WINDOWBITS);
@@ -1426,6 +1911,43 @@ void DefineZlibConstants(Local<Object> target) {
   NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_ERROR_ALLOC_RING_BUFFER_2);
   NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_ERROR_ALLOC_BLOCK_TYPE_TREES);
   NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_ERROR_UNREACHABLE);
+
+#if HAVE_ZSTD
+  // Zstd constants
+  NODE_DEFINE_CONSTANT(target, ZSTD_e_continue);
+  NODE_DEFINE_CONSTANT(target, ZSTD_e_flush);
+  NODE_DEFINE_CONSTANT(target, ZSTD_e_end);
+  NODE_DEFINE_CONSTANT(target, ZSTD_fast);
+  NODE_DEFINE_CONSTANT(target, ZSTD_dfast);
+  NODE_DEFINE_CONSTANT(target, ZSTD_greedy);
+  NODE_DEFINE_CONSTANT(target, ZSTD_lazy);
+  NODE_DEFINE_CONSTANT(target, ZSTD_lazy2);
+  NODE_DEFINE_CONSTANT(target, ZSTD_btlazy2);
+  NODE_DEFINE_CONSTANT(target, ZSTD_btopt);
+  NODE_DEFINE_CONSTANT(target, ZSTD_btultra);
+  NODE_DEFINE_CONSTANT(target, ZSTD_btultra2);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_compressionLevel);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_windowLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_hashLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_chainLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_searchLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_minMatch);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_targetLength);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_strategy);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_enableLongDistanceMatching);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_ldmHashLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_ldmMinMatch);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_ldmBucketSizeLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_ldmHashRateLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_contentSizeFlag);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_checksumFlag);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_dictIDFlag);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_nbWorkers);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_jobSize);
+  NODE_DEFINE_CONSTANT(target, ZSTD_c_overlapLog);
+  NODE_DEFINE_CONSTANT(target, ZSTD_d_windowLogMax);
+  NODE_DEFINE_CONSTANT(target, ZSTD_CLEVEL_DEFAULT);
+#endif
 }
 
 }  // namespace node
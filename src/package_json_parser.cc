@@ -0,0 +1,305 @@
+#include "package_json_parser.h"
+
+#include <cinttypes>
+
+namespace node {
+
+namespace {
+
+// Deeper documents are left to JSON.parse().
+constexpr size_t kMaxDepth = 1000;
+
+inline bool IsDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+inline int HexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// |str| is known to start with four hexadecimal digits.
+uint32_t ReadHex4(std::string_view str) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < 4; i++) value = (value << 4) | HexValue(str[i]);
+  return value;
+}
+
+void AppendUtf8(uint32_t code_point, std::string* out) {
+  if (code_point < 0x80) {
+    out->push_back(code_point);
+  } else if (code_point < 0x800) {
+    out->push_back(0xC0 | (code_point >> 6));
+    out->push_back(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x10000) {
+    out->push_back(0xE0 | (code_point >> 12));
+    out->push_back(0x80 | ((code_point >> 6) & 0x3F));
+    out->push_back(0x80 | (code_point & 0x3F));
+  } else {
+    out->push_back(0xF0 | (code_point >> 18));
+    out->push_back(0x80 | ((code_point >> 12) & 0x3F));
+    out->push_back(0x80 | ((code_point >> 6) & 0x3F));
+    out->push_back(0x80 | (code_point & 0x3F));
+  }
+}
+
+// Decodes the contents of a JSON string, which have been validated already.
+// Returns false if they contain an unpaired surrogate.
+bool DecodeString(std::string_view contents, std::string* out) {
+  out->clear();
+  out->reserve(contents.size());
+  for (size_t i = 0; i < contents.size(); i++) {
+    char c = contents[i];
+    if (c != '\\') {
+      out->push_back(c);
+      continue;
+    }
+    switch (c = contents[++i]) {
+      case 'b': out->push_back('\b'); break;
+      case 'f': out->push_back('\f'); break;
+      case 'n': out->push_back('\n'); break;
+      case 'r': out->push_back('\r'); break;
+      case 't': out->push_back('\t'); break;
+      case 'u': {
+        uint32_t code_point = ReadHex4(contents.substr(i + 1));
+        i += 4;
+        if (code_point >= 0xDC00 && code_point <= 0xDFFF) return false;
+        if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+          if (i + 6 >= contents.size() || contents[i + 1] != '\\' ||
+              contents[i + 2] != 'u') {
+            return false;
+          }
+          uint32_t low = ReadHex4(contents.substr(i + 3));
+          if (low < 0xDC00 || low > 0xDFFF) return false;
+          code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+          i += 6;
+        }
+        AppendUtf8(code_point, out);
+        break;
+      }
+      default:  // '"', '\\' or '/'.
+        out->push_back(c);
+    }
+  }
+  return true;
+}
+
+class Parser {
+ public:
+  explicit Parser(std::string_view source) : source_(source) {}
+
+  bool Parse(PackageJSONFields* fields);
+
+ private:
+  bool at_end() const { return pos_ >= source_.size(); }
+  char peek() const { return source_[pos_]; }
+
+  bool Consume(char c) {
+    if (at_end() || peek() != c) return false;
+    pos_++;
+    return true;
+  }
+
+  void SkipWhitespace() {
+    while (!at_end() &&
+           (peek() == ' ' || peek() == '\n' || peek() == '\r' ||
+            peek() == '\t')) {
+      pos_++;
+    }
+  }
+
+  bool SkipDigits() {
+    const size_t start = pos_;
+    while (!at_end() && IsDigit(peek())) pos_++;
+    return pos_ > start;
+  }
+
+  bool ParseValue(size_t depth);
+  bool ParseObject(size_t depth);
+  bool ParseArray(size_t depth);
+  // Sets |contents| to the text between the quotes, without decoding it.
+  bool ParseString(std::string_view* contents);
+  bool ParseNumber();
+  bool ParseLiteral(std::string_view literal);
+
+  std::string_view source_;
+  size_t pos_ = 0;
+};
+
+bool Parser::ParseValue(size_t depth) {
+  if (at_end() || depth > kMaxDepth) return false;
+  switch (peek()) {
+    case '{':
+      return ParseObject(depth + 1);
+    case '[':
+      return ParseArray(depth + 1);
+    case '"': {
+      std::string_view contents;
+      return ParseString(&contents);
+    }
+    case 't':
+      return ParseLiteral("true");
+    case 'f':
+      return ParseLiteral("false");
+    case 'n':
+      return ParseLiteral("null");
+    default:
+      return ParseNumber();
+  }
+}
+
+bool Parser::ParseObject(size_t depth) {
+  pos_++;  // '{'
+  SkipWhitespace();
+  if (Consume('}')) return true;
+  do {
+    SkipWhitespace();
+    std::string_view key;
+    if (!ParseString(&key)) return false;
+    SkipWhitespace();
+    if (!Consume(':')) return false;
+    SkipWhitespace();
+    if (!ParseValue(depth)) return false;
+    SkipWhitespace();
+  } while (Consume(','));
+  return Consume('}');
+}
+
+bool Parser::ParseArray(size_t depth) {
+  pos_++;  // '['
+  SkipWhitespace();
+  if (Consume(']')) return true;
+  do {
+    SkipWhitespace();
+    if (!ParseValue(depth)) return false;
+    SkipWhitespace();
+  } while (Consume(','));
+  return Consume(']');
+}
+
+bool Parser::ParseString(std::string_view* contents) {
+  if (!Consume('"')) return false;
+  const size_t start = pos_;
+  while (!at_end()) {
+    const unsigned char c = peek();
+    if (c == '"') {
+      *contents = source_.substr(start, pos_ - start);
+      pos_++;
+      return true;
+    }
+    if (c < 0x20) return false;
+    pos_++;
+    if (c != '\\') continue;
+    if (at_end()) return false;
+    switch (peek()) {
+      case '"':
+      case '\\':
+      case '/':
+      case 'b':
+      case 'f':
+      case 'n':
+      case 'r':
+      case 't':
+        pos_++;
+        break;
+      case 'u':
+        pos_++;
+        for (size_t i = 0; i < 4; i++, pos_++) {
+          if (at_end() || HexValue(peek()) < 0) return false;
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+bool Parser::ParseNumber() {
+  Consume('-');
+  if (Consume('0')) {
+    // No leading zeros.
+  } else if (!SkipDigits()) {
+    return false;
+  }
+  if (Consume('.') && !SkipDigits()) return false;
+  if (Consume('e') || Consume('E')) {
+    if (!Consume('+')) Consume('-');
+    if (!SkipDigits()) return false;
+  }
+  return true;
+}
+
+bool Parser::ParseLiteral(std::string_view literal) {
+  if (source_.substr(pos_, literal.size()) != literal) return false;
+  pos_ += literal.size();
+  return true;
+}
+
+// Keeps the decoded value of |value| if it is a string.
+bool SetStringField(std::string_view value, std::optional<std::string>* out) {
+  if (value[0] != '"') {
+    out->reset();
+    return true;
+  }
+  std::string decoded;
+  if (!DecodeString(value.substr(1, value.size() - 2), &decoded)) return false;
+  *out = std::move(decoded);
+  return true;
+}
+
+bool Parser::Parse(PackageJSONFields* fields) {
+  SkipWhitespace();
+  if (at_end() || peek() != '{') return false;
+  pos_++;
+  SkipWhitespace();
+  if (!Consume('}')) {
+    std::string decoded_key;
+    do {
+      SkipWhitespace();
+      std::string_view key;
+      if (!ParseString(&key)) return false;
+      SkipWhitespace();
+      if (!Consume(':')) return false;
+      SkipWhitespace();
+      const size_t value_start = pos_;
+      if (!ParseValue(1)) return false;
+      std::string_view value =
+          source_.substr(value_start, pos_ - value_start);
+      SkipWhitespace();
+
+      if (key.find('\\') != std::string_view::npos) {
+        // Keys with unpaired surrogates cannot be any of the fields.
+        if (!DecodeString(key, &decoded_key)) continue;
+        key = decoded_key;
+      }
+      bool ok = true;
+      if (key == "name") {
+        ok = SetStringField(value, &fields->name);
+      } else if (key == "main") {
+        ok = SetStringField(value, &fields->main);
+      } else if (key == "type") {
+        ok = SetStringField(value, &fields->type);
+      } else if (key == "exports") {
+        fields->exports = value;
+      } else if (key == "imports") {
+        fields->imports = value;
+      }
+      if (!ok) return false;
+    } while (Consume(','));
+    if (!Consume('}')) return false;
+  }
+  SkipWhitespace();
+  return at_end();
+}
+
+}  // anonymous namespace
+
+bool ParsePackageJSON(std::string_view source, PackageJSONFields* fields) {
+  *fields = PackageJSONFields();
+  return Parser(source).Parse(fields);
+}
+
+}  // namespace node
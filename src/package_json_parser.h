@@ -0,0 +1,37 @@
+#ifndef SRC_PACKAGE_JSON_PARSER_H_
+#define SRC_PACKAGE_JSON_PARSER_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace node {
+
+// The fields of a package.json file that are used to resolve modules.
+struct PackageJSONFields {
+  // Values of the fields that are strings, absent if the field is missing or
+  // is not a string.
+  std::optional<std::string> name;
+  std::optional<std::string> main;
+  std::optional<std::string> type;
+  // JSON text of the values of the fields, empty if the field is missing.
+  std::string_view exports;
+  std::string_view imports;
+};
+
+// Validates |source| as JSON and extracts the fields used to resolve modules
+// from it, without materializing the rest of the document. Like JSON.parse(),
+// the last occurrence of a duplicated key wins. Returns false if |source| is
+// not a valid JSON object, or if one of the extracted strings contains an
+// unpaired surrogate, which cannot be represented in UTF-8. The caller is
+// expected to fall back to JSON.parse() in that case, which also produces the
+// appropriate error.
+bool ParsePackageJSON(std::string_view source, PackageJSONFields* fields);
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_PACKAGE_JSON_PARSER_H_
@@ -35,7 +35,7 @@ struct Packet::Data final : public MemoryRetainer {
   // The diagnostic_label_ is used only as a debugging tool when
   // logging debug information about the packet. It identifies
   // the purpose of the packet.
-  const std::string diagnostic_label_;
+  std::string diagnostic_label_;
 
   void MemoryInfo(MemoryTracker* tracker) const override {
     tracker->TrackFieldWithSize("data", data_.length());
@@ -48,6 +48,20 @@ struct Packet::Data final : public MemoryRetainer {
     data_.AllocateSufficientStorage(length);
   }
 
+  // Prepares a Data that is being recycled from the freelist to hold
+  // a new packet of the given length.
+  void Reset(size_t length, std::string_view diagnostic_label) {
+    diagnostic_label_ = diagnostic_label;
+    data_.AllocateSufficientStorage(length);
+  }
+
+  // Only Data instances that are exclusively owned and still use
+  // the inline stack storage are retained by freelisted packets.
+  // Larger heap allocated buffers are released.
+  static bool CanRecycle(const std::shared_ptr<Data>& data) {
+    return data && data.use_count() == 1 && !data->data_.IsAllocated();
+  }
+
   size_t length() const { return data_.length(); }
   operator uv_buf_t() {
     return uv_buf_init(reinterpret_cast<char*>(data_.out()), data_.length());
@@ -118,10 +132,13 @@ BaseObjectPtr<Packet> Packet::Create(Environment* env,
         env, listener, obj, destination, length, diagnostic_label);
   }
 
-  return FromFreeList(env,
-                      std::make_shared<Data>(length, diagnostic_label),
-                      listener,
-                      destination);
+  auto packet = FromFreeList(env, listener, destination);
+  if (packet->data_) {
+    packet->data_->Reset(length, diagnostic_label);
+  } else {
+    packet->data_ = std::make_shared<Data>(length, diagnostic_label);
+  }
+  return packet;
 }
 
 BaseObjectPtr<Packet> Packet::Clone() const {
@@ -138,11 +155,14 @@ BaseObjectPtr<Packet> Packet::Clone() const {
     return MakeBaseObject<Packet>(env(), listener_, obj, destination_, data_);
   }
 
-  return FromFreeList(env(), data_, listener_, destination_);
+  auto packet = FromFreeList(env(), listener_, destination_);
+  // The clone shares this packet's data, so any storage retained by the
+  // freelisted packet is dropped.
+  packet->data_ = data_;
+  return packet;
 }
 
 BaseObjectPtr<Packet> Packet::FromFreeList(Environment* env,
-                                           std::shared_ptr<Data> data,
                                            Listener* listener,
                                            const SocketAddress& destination) {
   auto& binding = BindingData::Get(env);
@@ -150,7 +170,6 @@ BaseObjectPtr<Packet> Packet::FromFreeList(Environment* env,
   binding.packet_freelist.pop_back();
   DCHECK_EQ(env, obj->env());
   auto packet = static_cast<Packet*>(obj.get());
-  packet->data_ = std::move(data);
   packet->destination_ = destination;
   packet->listener_ = listener;
   return BaseObjectPtr<Packet>(packet);
@@ -202,15 +221,17 @@ void Packet::Done(int status) {
   DCHECK_NOT_NULL(listener_);
   listener_->PacketDone(status);
   handle_.reset();
-  data_.reset();
   listener_ = nullptr;
   Reset();
 
   // As a performance optimization, we add this packet to a freelist
   // rather than deleting it but only if the freelist isn't too
-  // big, we don't want to accumulate these things forever.
+  // big, we don't want to accumulate these things forever. The
+  // packet holds on to its storage while freelisted if it can be
+  // reused by the next call to Create().
   auto& binding = BindingData::Get(env());
   if (binding.packet_freelist.size() < kMaxFreeList) {
+    if (!Data::CanRecycle(data_)) data_.reset();
     binding.packet_freelist.emplace_back(this);
   } else {
     delete this;
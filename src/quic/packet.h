@@ -39,7 +39,9 @@ struct PathDescriptor {
 // a Packet, we'll check to see if there is a free
 // packet in the freelist and use it instead of starting
 // fresh with a new packet. The freelist can store at
-// most kMaxFreeList packets
+// most kMaxFreeList packets. A freelisted packet keeps
+// its stack-allocated storage so that the next Create()
+// can reuse it without allocating a new Data.
 //
 // Packets are always encrypted so their content should
 // be considered opaque to us. We leave it entirely up
@@ -148,7 +150,6 @@ class Packet final : public ReqWrap<uv_udp_send_t> {
 
  private:
   static BaseObjectPtr<Packet> FromFreeList(Environment* env,
-                                            std::shared_ptr<Data> data,
                                             Listener* listener,
                                             const SocketAddress& destination);
 
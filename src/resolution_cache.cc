@@ -0,0 +1,390 @@
+#include "resolution_cache.h"
+#include "env-inl.h"
+#include "node_internals.h"
+#include "util-inl.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <cstring>
+
+namespace node {
+
+namespace {
+
+inline bool IsPathSeparator(char c) {
+#ifdef _WIN32
+  return c == '\\' || c == '/';
+#else
+  return c == '/';
+#endif
+}
+
+bool IsAbsolutePath(const std::string& path) {
+  if (path.empty()) return false;
+  if (IsPathSeparator(path[0])) return true;
+#ifdef _WIN32
+  return path.size() > 2 && path[1] == ':' && IsPathSeparator(path[2]);
+#else
+  return false;
+#endif
+}
+
+// Splits |path| into the directory that contains it and its base name.
+// Returns false for roots and for paths with a trailing separator, which
+// are not cached.
+bool SplitPath(const std::string& path, std::string* dir, std::string* base) {
+  size_t pos = path.size();
+  while (pos > 0 && !IsPathSeparator(path[pos - 1])) pos--;
+  if (pos == 0 || pos == path.size()) return false;
+  // Keep the separator of roots, e.g. / or C:\, which would otherwise refer
+  // to something else.
+  size_t dir_length = pos - 1;
+  if (dir_length == 0 || path[dir_length - 1] == ':') dir_length++;
+  *dir = path.substr(0, dir_length);
+  *base = path.substr(pos);
+  return true;
+}
+
+int StatUncached(const char* path, uv_stat_t* stat) {
+  uv_fs_t req;
+  int rc = uv_fs_stat(nullptr, &req, path, nullptr);
+  if (rc == 0) {
+    const uv_stat_t* const s = static_cast<const uv_stat_t*>(req.ptr);
+    rc = !!(s->st_mode & S_IFDIR);
+    if (stat != nullptr) *stat = *s;
+  }
+  uv_fs_req_cleanup(&req);
+  return rc;
+}
+
+inline bool IsSameTime(const uv_timespec_t& a, const uv_timespec_t& b) {
+  return a.tv_sec == b.tv_sec && a.tv_nsec == b.tv_nsec;
+}
+
+class CacheWriter {
+ public:
+  void WriteUint32(uint32_t value) { Append(&value, sizeof(value)); }
+  void WriteInt64(int64_t value) { Append(&value, sizeof(value)); }
+  void WriteTime(const uv_timespec_t& time) {
+    WriteInt64(time.tv_sec);
+    WriteInt64(time.tv_nsec);
+  }
+  void WriteString(const std::string& value) {
+    WriteUint32(value.size());
+    data_.append(value);
+  }
+
+  std::string& data() { return data_; }
+
+ private:
+  void Append(const void* data, size_t size) {
+    data_.append(static_cast<const char*>(data), size);
+  }
+
+  std::string data_;
+};
+
+// All the methods return false once the data is exhausted.
+class CacheReader {
+ public:
+  CacheReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+  bool ReadUint32(uint32_t* value) { return Read(value, sizeof(*value)); }
+  bool ReadInt64(int64_t* value) { return Read(value, sizeof(*value)); }
+  bool ReadTime(uv_timespec_t* time) {
+    int64_t sec, nsec;
+    if (!ReadInt64(&sec) || !ReadInt64(&nsec)) return false;
+    time->tv_sec = sec;
+    time->tv_nsec = nsec;
+    return true;
+  }
+  bool ReadString(std::string* value) {
+    uint32_t size;
+    if (!ReadUint32(&size) || size > size_ - offset_) return false;
+    value->assign(data_ + offset_, size);
+    offset_ += size;
+    return true;
+  }
+
+  bool at_end() const { return offset_ == size_; }
+
+ private:
+  bool Read(void* value, size_t size) {
+    if (size > size_ - offset_) return false;
+    memcpy(value, data_ + offset_, size);
+    offset_ += size;
+    return true;
+  }
+
+  const char* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+}  // anonymous namespace
+
+ResolutionCache::ResolutionCache(Environment* env, std::string cache_path)
+    : env_(env), cache_path_(std::move(cache_path)) {
+  // Resolve the path now, in case the application changes its working
+  // directory before the cache is persisted.
+  if (!IsAbsolutePath(cache_path_))
+    cache_path_ = env->GetCwd() + kPathSeparator + cache_path_;
+}
+
+int ResolutionCache::ReadFileUncached(const char* path,
+                                      std::string* contents,
+                                      uv_stat_t* stat) {
+  uv_fs_t req;
+  const int fd = uv_fs_open(nullptr, &req, path, O_RDONLY, 0, nullptr);
+  uv_fs_req_cleanup(&req);
+  if (fd < 0) return fd;
+
+  auto defer_close = OnScopeLeave([fd]() {
+    uv_fs_t close_req;
+    CHECK_EQ(0, uv_fs_close(nullptr, &close_req, fd, nullptr));
+    uv_fs_req_cleanup(&close_req);
+  });
+
+  if (stat != nullptr) {
+    int err = uv_fs_fstat(nullptr, &req, fd, nullptr);
+    if (err == 0) *stat = *static_cast<const uv_stat_t*>(req.ptr);
+    uv_fs_req_cleanup(&req);
+    if (err < 0) return err;
+  }
+
+  const size_t kBlockSize = 32 << 10;
+  contents->clear();
+  int64_t offset = 0;
+  ssize_t numchars;
+  do {
+    const size_t start = contents->size();
+    contents->resize(start + kBlockSize);
+
+    uv_buf_t buf;
+    buf.base = &(*contents)[start];
+    buf.len = kBlockSize;
+
+    numchars = uv_fs_read(nullptr, &req, fd, &buf, 1, offset, nullptr);
+    uv_fs_req_cleanup(&req);
+
+    if (numchars < 0) {
+      contents->clear();
+      return numchars;
+    }
+    offset += numchars;
+    contents->resize(offset);
+  } while (static_cast<size_t>(numchars) == kBlockSize);
+
+  return 0;
+}
+
+int ResolutionCache::Stat(const std::string& path) {
+  bool from_record;
+  return Stat(path, &from_record);
+}
+
+int ResolutionCache::Stat(const std::string& path, bool* from_record) {
+  *from_record = false;
+  std::string dir, base;
+  if (!SplitPath(path, &dir, &base)) return StatUncached(path.c_str(), nullptr);
+
+  bool missing;
+  DirectoryRecord* record = GetDirectory(dir, &missing);
+  if (record == nullptr) {
+    if (!missing) return StatUncached(path.c_str(), nullptr);
+    *from_record = true;
+    return UV_ENOENT;
+  }
+
+  *from_record = true;
+  auto it = record->stats.find(base);
+  if (it != record->stats.end()) return it->second;
+
+  int rc = StatUncached(path.c_str(), nullptr);
+  record->stats.emplace(std::move(base), rc);
+  dirty_ = true;
+  return rc;
+}
+
+ResolutionCache::DirectoryRecord* ResolutionCache::GetDirectory(
+    const std::string& dir, bool* missing) {
+  *missing = false;
+  auto it = directories_.find(dir);
+  if (it != directories_.end() && it->second.verified) return &it->second;
+
+  // Check that the directory exists through the record of its parent first,
+  // so that the lookups of the many paths probed in missing node_modules
+  // directories are answered without any system call.
+  bool from_record;
+  int rc = Stat(dir, &from_record);
+  if (rc != 1) {
+    *missing = rc < 0 && from_record;
+    return nullptr;
+  }
+
+  uv_stat_t stat;
+  if (StatUncached(dir.c_str(), &stat) != 1) return nullptr;
+
+  // Looking up the parent may have added records and invalidated |it|.
+  it = directories_.find(dir);
+  DirectoryRecord* record;
+  if (it == directories_.end()) {
+    record = &directories_[dir];
+  } else {
+    record = &it->second;
+    if (IsSameTime(record->mtime, stat.st_mtim)) {
+      record->verified = true;
+      return record;
+    }
+    record->stats.clear();
+    record->package_jsons.clear();
+  }
+  record->mtime = stat.st_mtim;
+  record->verified = true;
+  dirty_ = true;
+  return record;
+}
+
+bool ResolutionCache::ReadPackageJSON(const std::string& path,
+                                      std::string* contents) {
+  std::string dir, base;
+  if (!SplitPath(path, &dir, &base))
+    return ReadFileUncached(path.c_str(), contents, nullptr) == 0;
+
+  bool missing;
+  DirectoryRecord* record = GetDirectory(dir, &missing);
+  if (record == nullptr) {
+    return !missing &&
+           ReadFileUncached(path.c_str(), contents, nullptr) == 0;
+  }
+
+  auto it = record->package_jsons.find(base);
+  if (it != record->package_jsons.end()) {
+    PackageJSONRecord* pjson = &it->second;
+    // Missing files would have changed the modification time of the
+    // directory when they were created.
+    if (!pjson->exists) return false;
+    if (!pjson->verified) {
+      uv_stat_t stat;
+      pjson->verified = StatUncached(path.c_str(), &stat) == 0 &&
+                        IsSameTime(pjson->mtime, stat.st_mtim) &&
+                        stat.st_size == pjson->contents.size();
+    }
+    if (pjson->verified) {
+      *contents = pjson->contents;
+      return true;
+    }
+  }
+
+  PackageJSONRecord* pjson = &record->package_jsons[base];
+  uv_stat_t stat;
+  pjson->exists =
+      ReadFileUncached(path.c_str(), &pjson->contents, &stat) == 0;
+  pjson->verified = true;
+  if (pjson->exists) {
+    pjson->mtime = stat.st_mtim;
+    *contents = pjson->contents;
+  } else {
+    pjson->contents.clear();
+  }
+  dirty_ = true;
+  return pjson->exists;
+}
+
+void ResolutionCache::Load() {
+  std::string data;
+  if (ReadFileSync(&data, cache_path_.c_str()) < 0) return;
+  if (!Deserialize(data)) {
+    // Start over rather than relying on a corrupted cache.
+    directories_.clear();
+    dirty_ = true;
+  }
+}
+
+bool ResolutionCache::Deserialize(const std::string& data) {
+  CacheReader header(data.data(), data.size());
+  uint32_t magic, size, hash;
+  if (!header.ReadUint32(&magic) || !header.ReadUint32(&size) ||
+      !header.ReadUint32(&hash) || magic != kMagic) {
+    return false;
+  }
+  const size_t header_size = 3 * sizeof(uint32_t);
+  const char* payload = data.data() + header_size;
+  if (size != data.size() - header_size || hash != GetCrc32(payload, size))
+    return false;
+
+  CacheReader reader(payload, size);
+  uint32_t directory_count;
+  if (!reader.ReadUint32(&directory_count)) return false;
+  for (uint32_t i = 0; i < directory_count; i++) {
+    std::string dir;
+    DirectoryRecord record;
+    uint32_t stat_count, package_json_count;
+    if (!reader.ReadString(&dir) || !reader.ReadTime(&record.mtime) ||
+        !reader.ReadUint32(&stat_count)) {
+      return false;
+    }
+    for (uint32_t j = 0; j < stat_count; j++) {
+      std::string base;
+      uint32_t rc;
+      if (!reader.ReadString(&base) || !reader.ReadUint32(&rc)) return false;
+      record.stats.emplace(std::move(base), static_cast<int32_t>(rc));
+    }
+    if (!reader.ReadUint32(&package_json_count)) return false;
+    for (uint32_t j = 0; j < package_json_count; j++) {
+      std::string base;
+      PackageJSONRecord pjson;
+      uint32_t exists;
+      if (!reader.ReadString(&base) || !reader.ReadUint32(&exists) ||
+          !reader.ReadTime(&pjson.mtime) ||
+          !reader.ReadString(&pjson.contents)) {
+        return false;
+      }
+      pjson.exists = exists != 0;
+      record.package_jsons.emplace(std::move(base), std::move(pjson));
+    }
+    directories_.emplace(std::move(dir), std::move(record));
+  }
+  return reader.at_end();
+}
+
+std::string ResolutionCache::Serialize() const {
+  CacheWriter writer;
+  writer.WriteUint32(directories_.size());
+  for (const auto& dir : directories_) {
+    const DirectoryRecord& record = dir.second;
+    writer.WriteString(dir.first);
+    writer.WriteTime(record.mtime);
+    writer.WriteUint32(record.stats.size());
+    for (const auto& stat : record.stats) {
+      writer.WriteString(stat.first);
+      writer.WriteUint32(static_cast<uint32_t>(stat.second));
+    }
+    writer.WriteUint32(record.package_jsons.size());
+    for (const auto& pjson : record.package_jsons) {
+      writer.WriteString(pjson.first);
+      writer.WriteUint32(pjson.second.exists);
+      writer.WriteTime(pjson.second.mtime);
+      writer.WriteString(pjson.second.contents);
+    }
+  }
+
+  const std::string& payload = writer.data();
+  CacheWriter header;
+  header.WriteUint32(kMagic);
+  header.WriteUint32(payload.size());
+  header.WriteUint32(GetCrc32(payload.data(), payload.size()));
+  return header.data() + payload;
+}
+
+bool ResolutionCache::Persist() {
+  if (!dirty_) return true;
+  if (WriteFileSyncAtomically(cache_path_, Serialize(), env_->thread_id()) !=
+      0) {
+    return false;
+  }
+  dirty_ = false;
+  return true;
+}
+
+}  // namespace node
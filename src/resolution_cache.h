@@ -0,0 +1,94 @@
+#ifndef SRC_RESOLUTION_CACHE_H_
+#define SRC_RESOLUTION_CACHE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <cinttypes>
+#include <string>
+#include <unordered_map>
+#include "uv.h"
+
+namespace node {
+class Environment;
+
+// Caches the file system lookups done while resolving modules, that is the
+// results of internalModuleStat() and the package.json files read by
+// internalModuleReadJSON(), and persists them in a file so that later runs
+// of the same application can skip probing the file system.
+//
+// The entries are grouped by the directory that contains them. A directory
+// is checked against its modification time the first time it is used in a
+// process, which is updated whenever entries are added to or removed from
+// it. The entries of directories that have changed since are dropped.
+// package.json files are additionally checked against their own modification
+// time and size. Changes made to a directory after it has been checked are
+// not noticed until the next run of the application.
+class ResolutionCache {
+ public:
+  ResolutionCache(Environment* env, std::string cache_path);
+
+  // Loads the entries persisted by an earlier run, if any.
+  void Load();
+  // Writes the entries to the cache file, if any has changed since it was
+  // loaded or last written.
+  bool Persist();
+
+  // Returns 0 if the path refers to a file, 1 when it is a directory or
+  // < 0 on error, like internalModuleStat().
+  int Stat(const std::string& path);
+  // Returns false if the file does not exist or cannot be read.
+  bool ReadPackageJSON(const std::string& path, std::string* contents);
+
+  // Reads a whole file without going through the cache. If |stat| is not
+  // nullptr, the file is also stat'ed through the open file descriptor.
+  static int ReadFileUncached(const char* path,
+                              std::string* contents,
+                              uv_stat_t* stat);
+
+  const std::string& cache_path() const { return cache_path_; }
+
+ private:
+  struct PackageJSONRecord {
+    bool exists = false;
+    // Whether the file has been checked against its modification time in
+    // this process.
+    bool verified = false;
+    uv_timespec_t mtime = {0, 0};
+    std::string contents;
+  };
+
+  struct DirectoryRecord {
+    // Whether the directory has been checked against its modification time
+    // in this process.
+    bool verified = false;
+    uv_timespec_t mtime = {0, 0};
+    // Results of Stat() of the entries, keyed by their base names.
+    std::unordered_map<std::string, int> stats;
+    std::unordered_map<std::string, PackageJSONRecord> package_jsons;
+  };
+
+  // Like Stat(), but reports whether the result is known from the record
+  // of the parent directory rather than from the file system.
+  int Stat(const std::string& path, bool* from_record);
+  // Returns nullptr if the directory cannot be cached. |missing| is set if
+  // the directory is known to not exist, which means that none of the
+  // entries under it exist either.
+  DirectoryRecord* GetDirectory(const std::string& dir, bool* missing);
+
+  bool Deserialize(const std::string& data);
+  std::string Serialize() const;
+
+  static constexpr uint32_t kMagic = 0x5E501CAC;
+
+  Environment* env_ = nullptr;
+  std::string cache_path_;
+  // Whether the entries differ from those in the cache file.
+  bool dirty_ = false;
+  std::unordered_map<std::string, DirectoryRecord> directories_;
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_RESOLUTION_CACHE_H_
@@ -33,6 +33,14 @@
 
 #include <algorithm>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define NODE_STRING_BYTES_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define NODE_STRING_BYTES_NEON 1
+#include <arm_neon.h>
+#endif
+
 // When creating strings >= this length v8's gc spins up and consumes
 // most of the execution time. For these cases it's more performant to
 // use external string resources.
@@ -248,9 +256,9 @@ template <typename TypeName>
 static size_t hex_decode(char* buf,
                          size_t len,
                          const TypeName* src,
-                         const size_t srcLen) {
-  size_t i;
-  for (i = 0; i < len && i * 2 + 1 < srcLen; ++i) {
+                         const size_t srcLen,
+                         size_t i = 0) {
+  for (; i < len && i * 2 + 1 < srcLen; ++i) {
     unsigned a = unhex(static_cast<uint8_t>(src[i * 2 + 0]));
     unsigned b = unhex(static_cast<uint8_t>(src[i * 2 + 1]));
     if (!~a || !~b)
@@ -261,6 +269,99 @@ static size_t hex_decode(char* buf,
   return i;
 }
 
+#if NODE_STRING_BYTES_SSE2
+// Converts hex digits to their values. The lanes of |valid| are set for the
+// characters that are hex digits.
+static inline __m128i unhex_sse2(__m128i chars, __m128i* valid) {
+  const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+  const __m128i is_digit =
+      _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  const __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                      _mm_set1_epi8('a'));
+  const __m128i is_letter =
+      _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+  *valid = _mm_or_si128(is_digit, is_letter);
+  return _mm_or_si128(
+      _mm_and_si128(digit, is_digit),
+      _mm_and_si128(_mm_add_epi8(letter, _mm_set1_epi8(10)), is_letter));
+}
+
+// Combines the values of 8 pairs of hex digits into 8 bytes, one per 16-bit
+// lane.
+static inline __m128i combine_nibbles_sse2(__m128i nibbles) {
+  return _mm_or_si128(
+      _mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00F0)),
+      _mm_srli_epi16(nibbles, 8));
+}
+#elif NODE_STRING_BYTES_NEON
+static inline uint8x16_t unhex_neon(uint8x16_t chars, uint8x16_t* valid) {
+  const uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+  const uint8x16_t is_digit = vcleq_u8(digit, vdupq_n_u8(9));
+  const uint8x16_t letter =
+      vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  const uint8x16_t is_letter = vcleq_u8(letter, vdupq_n_u8(5));
+  *valid = vorrq_u8(is_digit, is_letter);
+  return vorrq_u8(vandq_u8(digit, is_digit),
+                  vandq_u8(vaddq_u8(letter, vdupq_n_u8(10)), is_letter));
+}
+#endif
+
+// One-byte input is decoded 16 bytes at a time, until a character that is
+// not a hex digit is found, in which case the scalar loop takes over to stop
+// at the right place.
+static size_t hex_decode(char* buf,
+                         size_t len,
+                         const char* src,
+                         const size_t srcLen) {
+  size_t i = 0;
+#if NODE_STRING_BYTES_SSE2
+  for (; i + 16 <= len && (i + 16) * 2 <= srcLen; i += 16) {
+    __m128i valid_lo, valid_hi;
+    const __m128i lo = unhex_sse2(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2)),
+        &valid_lo);
+    const __m128i hi = unhex_sse2(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2 + 16)),
+        &valid_hi);
+    if (_mm_movemask_epi8(_mm_and_si128(valid_lo, valid_hi)) != 0xFFFF) break;
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(buf + i),
+        _mm_packus_epi16(combine_nibbles_sse2(lo), combine_nibbles_sse2(hi)));
+  }
+#elif NODE_STRING_BYTES_NEON
+  for (; i + 16 <= len && (i + 16) * 2 <= srcLen; i += 16) {
+    // Deinterleaves the high and the low digits of each byte.
+    const uint8x16x2_t chars =
+        vld2q_u8(reinterpret_cast<const uint8_t*>(src + i * 2));
+    uint8x16_t valid_hi, valid_lo;
+    const uint8x16_t hi = unhex_neon(chars.val[0], &valid_hi);
+    const uint8x16_t lo = unhex_neon(chars.val[1], &valid_lo);
+    const uint64x2_t valid =
+        vreinterpretq_u64_u8(vandq_u8(valid_hi, valid_lo));
+    if ((vgetq_lane_u64(valid, 0) & vgetq_lane_u64(valid, 1)) != ~uint64_t{0})
+      break;
+    vst1q_u8(reinterpret_cast<uint8_t*>(buf + i),
+             vorrq_u8(vshlq_n_u8(hi, 4), lo));
+  }
+#endif
+  return hex_decode<char>(buf, len, src, srcLen, i);
+}
+
+// Copies the characters of a one-byte string, which can then be decoded
+// faster than the UTF-16 representation returned by String::Value.
+class OneByteValue : public MaybeStackBuffer<char> {
+ public:
+  OneByteValue(Isolate* isolate, Local<String> str)
+      : MaybeStackBuffer<char>(str->Length()) {
+    SetLength(str->Length());
+    str->WriteOneByte(isolate,
+                      reinterpret_cast<uint8_t*>(out()),
+                      0,
+                      str->Length(),
+                      String::NO_NULL_TERMINATION);
+  }
+};
+
 size_t StringBytes::WriteUCS2(
     Isolate* isolate, char* buf, size_t buflen, Local<String> str, int flags) {
   uint16_t* const dst = reinterpret_cast<uint16_t*>(buf);
@@ -351,6 +452,9 @@ size_t StringBytes::Write(Isolate* isolate,
       if (str->IsExternalOneByte()) {
         auto ext = str->GetExternalOneByteStringResource();
         nbytes = base64_decode(buf, buflen, ext->data(), ext->length());
+      } else if (str->IsOneByte()) {
+        OneByteValue value(isolate, str);
+        nbytes = base64_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(isolate, str);
         nbytes = base64_decode(buf, buflen, *value, value.length());
@@ -361,6 +465,9 @@ size_t StringBytes::Write(Isolate* isolate,
       if (str->IsExternalOneByte()) {
         auto ext = str->GetExternalOneByteStringResource();
         nbytes = hex_decode(buf, buflen, ext->data(), ext->length());
+      } else if (str->IsOneByte()) {
+        OneByteValue value(isolate, str);
+        nbytes = hex_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(isolate, str);
         nbytes = hex_decode(buf, buflen, *value, value.length());
@@ -528,7 +635,43 @@ size_t StringBytes::hex_encode(
       "not enough space provided for hex encode");
 
   dlen = slen * 2;
-  for (uint32_t i = 0, k = 0; k < dlen; i += 1, k += 2) {
+  size_t i = 0;
+#if NODE_STRING_BYTES_SSE2
+  // Turns nibbles into '0'-'9' and 'a'-'f'.
+  auto to_hex = [](__m128i nibbles) {
+    const __m128i letters =
+        _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                      _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+  };
+  for (; i + 16 <= slen; i += 16) {
+    const __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    const __m128i lo = _mm_and_si128(bytes, mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2),
+                     to_hex(_mm_unpacklo_epi8(hi, lo)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2 + 16),
+                     to_hex(_mm_unpackhi_epi8(hi, lo)));
+  }
+#elif NODE_STRING_BYTES_NEON
+  auto to_hex = [](uint8x16_t nibbles) {
+    const uint8x16_t letters = vandq_u8(vcgtq_u8(nibbles, vdupq_n_u8(9)),
+                                        vdupq_n_u8('a' - '0' - 10));
+    return vaddq_u8(vaddq_u8(nibbles, vdupq_n_u8('0')), letters);
+  };
+  for (; i + 16 <= slen; i += 16) {
+    const uint8x16_t bytes =
+        vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+    uint8x16x2_t chars;
+    chars.val[0] = to_hex(vshrq_n_u8(bytes, 4));
+    chars.val[1] = to_hex(vandq_u8(bytes, vdupq_n_u8(0x0F)));
+    // Interleaves the high and the low digits of each byte.
+    vst2q_u8(reinterpret_cast<uint8_t*>(dst + i * 2), chars);
+  }
+#endif
+  for (size_t k = i * 2; k < dlen; i += 1, k += 2) {
     static const char hex[] = "0123456789abcdef";
     uint8_t val = static_cast<uint8_t>(src[i]);
     dst[k + 0] = hex[val >> 4];
@@ -594,6 +737,11 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
 
     case UTF8:
       {
+        // Large ASCII inputs are turned into external strings instead of
+        // being decoded into the V8 heap, which is cheap to detect.
+        if (buflen >= EXTERN_APEX && simdutf::validate_ascii(buf, buflen)) {
+          return ExternOneByteString::NewFromCopy(isolate, buf, buflen, error);
+        }
         val = String::NewFromUtf8(isolate,
                                   buf,
                                   v8::NewStringType::kNormal,
@@ -657,13 +805,12 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
           *error = node::ERR_MEMORY_ALLOCATION_FAILED(isolate);
           return MaybeLocal<Value>();
         }
-        for (size_t i = 0, k = 0; k < str_len; i += 2, k += 1) {
-          // The input is in *little endian*, because that's what Node.js
-          // expects, so the high byte comes after the low byte.
-          const uint8_t hi = static_cast<uint8_t>(buf[i + 1]);
-          const uint8_t lo = static_cast<uint8_t>(buf[i + 0]);
-          dst[k] = static_cast<uint16_t>(hi) << 8 | lo;
-        }
+        // The input is in *little endian*, because that's what Node.js
+        // expects, so the high byte comes after the low byte.
+        memcpy(dst, buf, str_len * sizeof(*dst));
+        simdutf::change_endianness_utf16(reinterpret_cast<char16_t*>(dst),
+                                         str_len,
+                                         reinterpret_cast<char16_t*>(dst));
         return ExternTwoByteString::New(isolate, dst, str_len, error);
       }
       if (reinterpret_cast<uintptr_t>(buf) % 2 != 0) {
@@ -687,6 +834,38 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
 }
 
 
+MaybeLocal<String> StringBytes::EncodeUtf8Chunk(Isolate* isolate,
+                                                const char* buf,
+                                                size_t buflen,
+                                                Local<Value>* error) {
+  MaybeLocal<String> val;
+  if (simdutf::validate_ascii(buf, buflen)) {
+    // ASCII is a subset of Latin-1, so it can be copied into a one-byte
+    // string without decoding it.
+    val = String::NewFromOneByte(isolate,
+                                 reinterpret_cast<const uint8_t*>(buf),
+                                 v8::NewStringType::kNormal,
+                                 buflen);
+  } else {
+    // Validate and convert the input in a single pass. Every UTF-8 byte
+    // produces at most one UTF-16 code unit.
+    MaybeStackBuffer<uint16_t> utf16(buflen);
+    size_t utf16_length = simdutf::convert_utf8_to_utf16(
+        buf, buflen, reinterpret_cast<char16_t*>(utf16.out()));
+    if (utf16_length > 0) {
+      val = String::NewFromTwoByte(
+          isolate, utf16.out(), v8::NewStringType::kNormal, utf16_length);
+    } else {
+      // Leave the replacement of invalid sequences to V8's decoder, so that
+      // the result is the same as with Encode().
+      val = String::NewFromUtf8(
+          isolate, buf, v8::NewStringType::kNormal, buflen);
+    }
+  }
+  if (val.IsEmpty()) *error = node::ERR_STRING_TOO_LONG(isolate);
+  return val;
+}
+
 MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
                                       const uint16_t* buf,
                                       size_t buflen,
@@ -704,9 +883,10 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
       *error = node::ERR_MEMORY_ALLOCATION_FAILED(isolate);
       return MaybeLocal<Value>();
     }
-    size_t nbytes = buflen * sizeof(uint16_t);
-    memcpy(dst, buf, nbytes);
-    SwapBytes16(reinterpret_cast<char*>(dst), nbytes);
+    memcpy(dst, buf, buflen * sizeof(uint16_t));
+    simdutf::change_endianness_utf16(reinterpret_cast<char16_t*>(dst),
+                                     buflen,
+                                     reinterpret_cast<char16_t*>(dst));
     return ExternTwoByteString::New(isolate, dst, buflen, error);
   } else {
     return ExternTwoByteString::NewFromCopy(isolate, buf, buflen, error);
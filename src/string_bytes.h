@@ -84,6 +84,16 @@ class StringBytes {
                                           enum encoding encoding,
                                           v8::Local<v8::Value>* error);
 
+  // Like Encode() with UTF8, but converts non-ASCII input to UTF-16 with
+  // simdutf instead of leaving the decoding to V8. This is faster for the
+  // chunks that streaming decoders produce, which are rarely large enough to
+  // become external strings.
+  static v8::MaybeLocal<v8::String> EncodeUtf8Chunk(
+      v8::Isolate* isolate,
+      const char* buf,
+      size_t buflen,
+      v8::Local<v8::Value>* error);
+
   // Warning: This reverses endianness on BE platforms, even though the
   // signature using uint16_t implies that it should not.
   // However, the brokenness is already public API and can't therefore
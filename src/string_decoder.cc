@@ -31,17 +31,9 @@ MaybeLocal<String> MakeString(Isolate* isolate,
   Local<Value> error;
   MaybeLocal<Value> ret;
   if (encoding == UTF8) {
-    MaybeLocal<String> utf8_string = String::NewFromUtf8(
-        isolate,
-        data,
-        v8::NewStringType::kNormal,
-        length);
-    if (utf8_string.IsEmpty()) {
-      isolate->ThrowException(node::ERR_STRING_TOO_LONG(isolate));
-      return MaybeLocal<String>();
-    } else {
-      return utf8_string;
-    }
+    MaybeLocal<String> utf8_string =
+        StringBytes::EncodeUtf8Chunk(isolate, data, length, &error);
+    if (!utf8_string.IsEmpty()) ret = utf8_string.ToLocalChecked();
   } else {
     ret = StringBytes::Encode(
         isolate,
@@ -30,6 +30,7 @@
 #include "node_util.h"
 #include "string_bytes.h"
 #include "uv.h"
+#include "zlib.h"
 
 #ifdef _WIN32
 #include <io.h>  // _S_IREAD _S_IWRITE
@@ -218,6 +219,57 @@ int WriteFileSync(const char* path, uv_buf_t buf) {
   return err;
 }
 
+int WriteFileSyncAtomically(const std::string& path,
+                             const std::string& contents,
+                             uint64_t thread_id) {
+  // Write to a temporary file first, so that other processes reading the
+  // same path never see a partially written file.
+  std::string temp_path =
+      SPrintF("%s.%d.%d.tmp", path, uv_os_getpid(), thread_id);
+  uv_fs_t req;
+  int err = uv_fs_open(nullptr,
+                       &req,
+                       temp_path.c_str(),
+                       O_WRONLY | O_CREAT | O_TRUNC,
+                       0644,
+                       nullptr);
+  uv_fs_req_cleanup(&req);
+  if (err < 0) return err;
+  uv_file file = err;
+
+  size_t offset = 0;
+  while (offset < contents.size()) {
+    uv_buf_t buf = uv_buf_init(const_cast<char*>(contents.data() + offset),
+                               contents.size() - offset);
+    err = uv_fs_write(nullptr, &req, file, &buf, 1, offset, nullptr);
+    uv_fs_req_cleanup(&req);
+    if (err <= 0) {
+      if (err == 0) err = UV_EIO;
+      break;
+    }
+    offset += err;
+  }
+  uv_fs_close(nullptr, &req, file, nullptr);
+  uv_fs_req_cleanup(&req);
+
+  if (err >= 0) {
+    err = uv_fs_rename(
+        nullptr, &req, temp_path.c_str(), path.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+  }
+  if (err < 0) {
+    uv_fs_unlink(nullptr, &req, temp_path.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+    return err;
+  }
+  return 0;
+}
+
+uint32_t GetCrc32(const char* data, size_t size) {
+  uLong crc = crc32(0L, Z_NULL, 0);
+  return crc32(crc, reinterpret_cast<const Bytef*>(data), size);
+}
+
 int WriteFileSync(v8::Isolate* isolate,
                   const char* path,
                   v8::Local<v8::String> string) {
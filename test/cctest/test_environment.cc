@@ -1,5 +1,6 @@
 #include "node_buffer.h"
 #include "node_internals.h"
+#include "node_options.h"
 #include "libplatform/libplatform.h"
 #include "util.h"
 
@@ -398,6 +399,36 @@ TEST_F(EnvironmentTest, BufferWithFreeCallbackIsDetached) {
   CHECK_EQ(ab->ByteLength(), 0);
 }
 
+TEST_F(EnvironmentTest, PooledArrayBufferReallocateToZero) {
+  // Test that shrinking a pooled block to zero bytes returns the block to
+  // the pool instead of leaking it.
+  const int64_t pool_size =
+      node::per_process::cli_options->array_buffer_pool_size;
+  node::per_process::cli_options->array_buffer_pool_size = 1024 * 1024;
+  {
+    node::NodeArrayBufferAllocator allocator;
+    ASSERT_NE(allocator.pool(), nullptr);
+    constexpr size_t kSize = 4 * 1024;
+
+    void* data = allocator.Allocate(kSize);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(allocator.total_mem_usage(), kSize);
+
+    void* ret = allocator.Reallocate(data, kSize, 0);
+    EXPECT_EQ(allocator.total_mem_usage(), 0u);
+    if (ret != nullptr) allocator.Free(ret, 0);
+
+    bool found = false;
+    for (const auto& size_class : allocator.pool()->GetStats()) {
+      if (size_class.block_size != kSize) continue;
+      EXPECT_EQ(size_class.cached_blocks, 1u);
+      found = true;
+    }
+    EXPECT_TRUE(found);
+  }
+  node::per_process::cli_options->array_buffer_pool_size = pool_size;
+}
+
 #if HAVE_INSPECTOR
 TEST_F(EnvironmentTest, InspectorMultipleEmbeddedEnvironments) {
   // Tests that child Environments can be created through the public API
@@ -69,6 +69,9 @@ function _validateContent(report, fields = []) {
   if (isJavaScriptThreadReport)
     sections.push('javascriptHeap');
 
+  if (report.arrayBufferPool)
+    sections.push('arrayBufferPool');
+
   checkForUnknownFields(report, sections);
   sections.forEach((section) => {
     assert(Object.hasOwn(report, section));
@@ -283,6 +286,22 @@ function _validateContent(report, fields = []) {
     assert(Number.isSafeInteger(usage.fsActivity.writes));
   }
 
+  // Verify the format of the arrayBufferPool section, if present.
+  if (report.arrayBufferPool) {
+    const pool = report.arrayBufferPool;
+    checkForUnknownFields(pool, ['maxCachedMemory', 'sizeClasses']);
+    assert(Number.isSafeInteger(pool.maxCachedMemory));
+    assert(Array.isArray(pool.sizeClasses));
+    pool.sizeClasses.forEach((sizeClass) => {
+      checkForUnknownFields(sizeClass, ['blockSize', 'hits', 'misses',
+                                        'cachedBlocks']);
+      assert(Number.isSafeInteger(sizeClass.blockSize));
+      assert(Number.isSafeInteger(sizeClass.hits));
+      assert(Number.isSafeInteger(sizeClass.misses));
+      assert(Number.isSafeInteger(sizeClass.cachedBlocks));
+    });
+  }
+
   // Verify the format of the libuv section.
   assert(Array.isArray(report.libuv));
   report.libuv.forEach((resource) => {
@@ -3,6 +3,9 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
 
 // Note: This file is being referred to from doc/api/embedding.md, and excerpts
 // from it are included in the documentation. Try to keep these in sync.
@@ -21,8 +24,12 @@ using v8::Value;
 static int RunNodeInstance(MultiIsolatePlatform* platform,
                            const std::vector<std::string>& args,
                            const std::vector<std::string>& exec_args);
+static int StartFromSnapshotBlob(int argc, char** argv);
 
 int main(int argc, char** argv) {
+  if (argc >= 3 && strcmp(argv[1], "--embedder-snapshot-blob") == 0)
+    return StartFromSnapshotBlob(argc, argv);
+
   argv = uv_setup_args(argc, argv);
   std::vector<std::string> args(argv, argv + argc);
   std::unique_ptr<node::InitializationResult> result =
@@ -93,3 +100,28 @@ int RunNodeInstance(MultiIsolatePlatform* platform,
 
   return exit_code;
 }
+
+// Reads the snapshot blob named by `--embedder-snapshot-blob <file>` into
+// memory and boots from it with node::Start(). The remaining arguments are
+// passed on to Node.js.
+int StartFromSnapshotBlob(int argc, char** argv) {
+  FILE* fp = fopen(argv[2], "rb");
+  if (fp == nullptr) {
+    fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[2]);
+    return 1;
+  }
+  std::vector<char> blob;
+  char buf[4096];
+  size_t num_read;
+  while ((num_read = fread(buf, 1, sizeof(buf), fp)) > 0)
+    blob.insert(blob.end(), buf, buf + num_read);
+  fclose(fp);
+  if (blob.empty()) {
+    fprintf(stderr, "%s: %s is empty\n", argv[0], argv[2]);
+    return 1;
+  }
+
+  // Drop the two arguments that were consumed here.
+  std::copy(argv + 3, argv + argc + 1, argv + 1);
+  return node::Start(argc - 2, argv, blob.data(), blob.size());
+}
@@ -1,9 +1,11 @@
 'use strict';
 const common = require('../common');
 const fixtures = require('../common/fixtures');
+const tmpdir = require('../common/tmpdir');
 const assert = require('assert');
 const child_process = require('child_process');
 const path = require('path');
+const fs = require('fs');
 
 common.allowGlobals(global.require);
 common.allowGlobals(global.embedVars);
@@ -41,3 +43,40 @@ const fixturePath = JSON.stringify(fixtures.path('exit.js'));
 assert.strictEqual(
   child_process.spawnSync(binary, [`require(${fixturePath})`, 92]).status,
   92);
+
+// Start from a snapshot blob that is passed to node::Start() in memory.
+{
+  tmpdir.refresh();
+  const blobPath = path.join(tmpdir.path, 'snapshot.blob');
+  const entry = fixtures.path('snapshot', 'user-modules', 'entry.js');
+  // This may be run by embedtest itself, so build the snapshot with the node
+  // binary from the same build.
+  const node = path.join(path.dirname(binary),
+                         common.isWindows ? 'node.exe' : 'node');
+  const build = child_process.spawnSync(node, [
+    '--snapshot-blob', blobPath, '--build-snapshot', entry,
+  ], { cwd: tmpdir.path });
+  assert.strictEqual(build.status, 0, build.stderr.toString());
+
+  const child = child_process.spawnSync(binary, [
+    '--embedder-snapshot-blob', blobPath,
+  ], { cwd: tmpdir.path });
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  assert.strictEqual(child.stdout.toString().trim(),
+                     'hello snapshot, hello deserialized\nsame module: true');
+
+  const invalid = child_process.spawnSync(binary, [
+    '--embedder-snapshot-blob', __filename,
+  ]);
+  assert.strictEqual(invalid.status, 1);
+  assert.match(invalid.stderr.toString(), /not a snapshot blob/);
+
+  const truncatedPath = path.join(tmpdir.path, 'truncated.blob');
+  const blob = fs.readFileSync(blobPath);
+  fs.writeFileSync(truncatedPath, blob.subarray(0, blob.length / 2));
+  const truncated = child_process.spawnSync(binary, [
+    '--embedder-snapshot-blob', truncatedPath,
+  ]);
+  assert.strictEqual(truncated.status, 1);
+  assert.match(truncated.stderr.toString(), /blob is malformed/);
+}
@@ -0,0 +1,14 @@
+'use strict';
+
+const greeting = require('./lib/greeting');
+const { setDeserializeMainFunction } = require('v8').startupSnapshot;
+
+globalThis.greeting = greeting.greet('snapshot');
+
+setDeserializeMainFunction(() => {
+  // The module is in the snapshot, so requiring it again does not need the
+  // source files, which have been removed by the test.
+  const lib = require('./lib/greeting');
+  console.log(`${globalThis.greeting}, ${lib.greet('deserialized')}`);
+  console.log(`same module: ${lib === greeting}`);
+});
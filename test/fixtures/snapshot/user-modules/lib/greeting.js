@@ -0,0 +1,7 @@
+'use strict';
+
+module.exports = {
+  greet(name) {
+    return `hello ${name}`;
+  },
+};
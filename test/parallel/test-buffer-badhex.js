@@ -46,3 +46,30 @@ const assert = require('assert');
   const badHex = `${hex.slice(0, 256)}xx${hex.slice(256, 510)}`;
   assert.deepStrictEqual(Buffer.from(badHex, 'hex'), buf.slice(0, 128));
 }
+
+// Long inputs are decoded and encoded in blocks. Invalid characters must stop
+// the decoding at the right byte wherever they are in a block.
+{
+  const buf = Buffer.alloc(100);
+  for (let i = 0; i < buf.length; i++)
+    buf[i] = (i * 37) & 0xff;
+
+  const hex = buf.toString('hex');
+  assert.strictEqual(hex, Array.from(buf, (byte) => {
+    return byte.toString(16).padStart(2, '0');
+  }).join(''));
+  assert.deepStrictEqual(Buffer.from(hex.toUpperCase(), 'hex'), buf);
+
+  for (let i = 0; i < hex.length; i++) {
+    for (const bad of ['g', 'G', ':', '@', '`', ' ', 'é', '€']) {
+      const badHex = hex.slice(0, i) + bad + hex.slice(i + 1);
+      const expected = buf.subarray(0, i >> 1);
+      assert.deepStrictEqual(Buffer.from(badHex, 'hex'), expected);
+    }
+  }
+
+  // Decoding also stops when the target is full.
+  const target = Buffer.alloc(40);
+  assert.strictEqual(target.write(hex, 3, 'hex'), 37);
+  assert.deepStrictEqual(target.subarray(3), buf.subarray(0, 37));
+}
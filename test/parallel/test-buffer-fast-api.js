@@ -0,0 +1,102 @@
+// Flags: --allow-natives-syntax --turbo-fast-api-calls
+'use strict';
+
+// This tests that the Buffer methods with fast API variants behave the same
+// once they are optimized, including when the fast variants have to fall back
+// to the slow path to throw.
+
+require('../common');
+const assert = require('assert');
+const { isAscii, isUtf8 } = require('buffer');
+
+function optimize(fn, ...args) {
+  eval('%PrepareFunctionForOptimization(fn)');
+  fn(...args);
+  eval('%OptimizeFunctionOnNextCall(fn)');
+  fn(...args);
+}
+
+function compare(a, b) {
+  return Buffer.compare(a, b);
+}
+
+// The Buffer methods are called on Uint8Arrays as well.
+const {
+  compare: bufferCompare,
+  indexOf: bufferIndexOf,
+  lastIndexOf: bufferLastIndexOf,
+} = Buffer.prototype;
+
+function compareOffset(a, b, targetStart, targetEnd, sourceStart, sourceEnd) {
+  return bufferCompare.call(a, b, targetStart, targetEnd, sourceStart,
+                            sourceEnd);
+}
+
+function indexOf(buf, value, byteOffset) {
+  return bufferIndexOf.call(buf, value, byteOffset);
+}
+
+function lastIndexOf(buf, value, byteOffset) {
+  return bufferLastIndexOf.call(buf, value, byteOffset);
+}
+
+function validate(input) {
+  return [isAscii(input), isUtf8(input)];
+}
+
+const a = Buffer.from('abcdef');
+const b = Buffer.from('abcxyz');
+// Views that are backed by a buffer and views whose contents live on the heap.
+const large = Buffer.alloc(1024, 'a');
+const onHeap = new Uint8Array([0x61, 0x62, 0x63]);
+
+optimize(compare, a, b);
+assert.strictEqual(compare(a, b), -1);
+assert.strictEqual(compare(b, a), 1);
+assert.strictEqual(compare(a, a), 0);
+assert.strictEqual(compare(a, a.subarray(0, 3)), 1);
+assert.strictEqual(compare(onHeap, a), -1);
+assert.strictEqual(compare(large, Buffer.alloc(1024, 'a')), 0);
+assert.throws(() => compare(a, 'abc'), { code: 'ERR_INVALID_ARG_TYPE' });
+
+optimize(compareOffset, a, b, 0, 3, 0, 3);
+assert.strictEqual(compareOffset(a, b, 0, 3, 0, 3), 0);
+assert.strictEqual(compareOffset(a, b, 0, 4, 0, 4), -1);
+assert.strictEqual(compareOffset(a, b, 3, 6, 3, 6), -1);
+assert.strictEqual(compareOffset(b, a, 3, 6, 3, 6), 1);
+assert.strictEqual(compareOffset(onHeap, a, 0, 3, 0, 3), 0);
+assert.strictEqual(compareOffset(a, b, 10, 6, 0, 3), 1);
+assert.throws(() => compareOffset(a, b, 0, 7, 0, 3),
+              { code: 'ERR_OUT_OF_RANGE' });
+assert.throws(() => compareOffset(a, b, -1, 3, 0, 3),
+              { code: 'ERR_OUT_OF_RANGE' });
+
+optimize(indexOf, a, 0x63, 0);
+optimize(lastIndexOf, a, 0x63, 5);
+assert.strictEqual(indexOf(a, 0x63, 0), 2);
+assert.strictEqual(indexOf(a, 0x63, 3), -1);
+assert.strictEqual(indexOf(a, 0x63, -4), 2);
+assert.strictEqual(indexOf(a, 0x63, 1.5), 2);
+assert.strictEqual(indexOf(a, 0x163, 0), 2);
+assert.strictEqual(indexOf(onHeap, 0x62, 0), 1);
+assert.strictEqual(indexOf(large, 0x61, 1000), 1000);
+assert.strictEqual(indexOf(Buffer.alloc(0), 0, 0), -1);
+assert.strictEqual(lastIndexOf(a, 0x63, 5), 2);
+assert.strictEqual(lastIndexOf(a, 0x63, 1), -1);
+assert.strictEqual(lastIndexOf(a, 0x63, -100), -1);
+assert.strictEqual(lastIndexOf(onHeap, 0x61, Infinity), 0);
+
+const invalid = Buffer.from([0x61, 0xff]);
+optimize(validate, a);
+assert.deepStrictEqual(validate(a), [true, true]);
+assert.deepStrictEqual(validate(invalid), [false, false]);
+assert.deepStrictEqual(validate(Buffer.from('ä')), [false, true]);
+assert.deepStrictEqual(validate(onHeap), [true, true]);
+assert.deepStrictEqual(validate(large.buffer), [true, true]);
+assert.deepStrictEqual(validate(new Uint8Array(invalid).buffer),
+                       [false, false]);
+assert.deepStrictEqual(validate(new SharedArrayBuffer(8)), [true, true]);
+
+const detached = new ArrayBuffer(8);
+structuredClone(detached, { transfer: [detached] });
+assert.throws(() => validate(detached), { code: 'ERR_INVALID_STATE' });
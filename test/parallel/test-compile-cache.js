@@ -0,0 +1,82 @@
+'use strict';
+
+// This tests that NODE_COMPILE_CACHE persists the code cache of user
+// CommonJS and ES modules, and that it is only used for the same source.
+
+require('../common');
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+const { expectSyncExitWithoutError } = require('../common/child_process');
+const tmpdir = require('../common/tmpdir');
+const fs = require('fs');
+const path = require('path');
+
+tmpdir.refresh();
+const cacheDir = path.join(tmpdir.path, 'cache');
+
+const printStats = `
+const { flushCompileCache, getCompileCacheStats } = require('node:module');
+flushCompileCache();
+console.log(JSON.stringify(getCompileCacheStats() ?? null));
+`;
+
+fs.writeFileSync(tmpdir.resolve('dep.js'), 'module.exports = 42;');
+fs.writeFileSync(tmpdir.resolve('main.js'), `
+require('./dep.js');
+${printStats}`);
+fs.writeFileSync(tmpdir.resolve('dep.mjs'), 'export default 42;');
+fs.writeFileSync(tmpdir.resolve('main.mjs'), `
+import './dep.mjs';
+import { createRequire } from 'node:module';
+const require = createRequire(import.meta.url);
+${printStats}`);
+
+function run(entry, env = { NODE_COMPILE_CACHE: cacheDir }) {
+  const { stdout } = expectSyncExitWithoutError(
+    spawnSync(process.execPath, [tmpdir.resolve(entry)], {
+      cwd: tmpdir.path,
+      env: { ...process.env, ...env },
+    }), {});
+  return JSON.parse(stdout.toString());
+}
+
+assert.strictEqual(run('main.js', { NODE_COMPILE_CACHE: '' }), null);
+
+for (const [entry, dep, source] of [
+  ['main.js', 'dep.js', 'module.exports = 43;'],
+  ['main.mjs', 'dep.mjs', 'export default 43;'],
+]) {
+  let stats = run(entry);
+  assert.strictEqual(path.dirname(stats.directory), fs.realpathSync(cacheDir));
+  assert.deepStrictEqual(
+    { ...stats, directory: undefined },
+    { directory: undefined, hits: 0, misses: 2, rejected: 0, written: 2 });
+
+  stats = run(entry);
+  assert.deepStrictEqual(
+    { ...stats, directory: undefined },
+    { directory: undefined, hits: 2, misses: 0, rejected: 0, written: 0 });
+
+  // The cache of a changed module is not used, and gets replaced.
+  fs.writeFileSync(tmpdir.resolve(dep), source);
+  stats = run(entry);
+  assert.deepStrictEqual(
+    { ...stats, directory: undefined },
+    { directory: undefined, hits: 1, misses: 1, rejected: 0, written: 1 });
+
+  stats = run(entry);
+  assert.deepStrictEqual(
+    { ...stats, directory: undefined },
+    { directory: undefined, hits: 2, misses: 0, rejected: 0, written: 0 });
+}
+
+// Corrupted cache files are ignored and written again.
+{
+  const { directory } = run('main.js');
+  for (const file of fs.readdirSync(directory)) {
+    fs.appendFileSync(path.join(directory, file), 'garbage');
+  }
+  const stats = run('main.js');
+  assert.strictEqual(stats.hits, 0);
+  assert.strictEqual(stats.written, 2);
+}
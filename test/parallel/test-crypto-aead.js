@@ -0,0 +1,161 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+const ciphers = [
+  ['aes-128-gcm', 16],
+  ['aes-256-gcm', 32],
+  ['chacha20-poly1305', 32],
+];
+
+function legacySeal(cipher, key, iv, data, aad, authTagLength) {
+  const c = crypto.createCipheriv(cipher, key, iv, { authTagLength });
+  if (aad !== undefined)
+    c.setAAD(Buffer.from(aad));
+  return Buffer.concat([c.update(data), c.final(), c.getAuthTag()]);
+}
+
+for (const [cipher, keyLength] of ciphers) {
+  const key = crypto.randomBytes(keyLength);
+  const aead = crypto.createAEAD(cipher, key);
+  const iv = crypto.randomBytes(12);
+
+  // The output matches that of Cipheriv, with the tag appended.
+  for (const data of ['', 'a', 'x'.repeat(1000)]) {
+    for (const aad of [undefined, 'header']) {
+      const sealed = aead.seal(iv, data, aad);
+      assert(Buffer.isBuffer(sealed));
+      assert.strictEqual(sealed.length, Buffer.byteLength(data) + 16);
+      assert.deepStrictEqual(
+        sealed, legacySeal(cipher, key, iv, Buffer.from(data), aad, 16));
+      assert.strictEqual(aead.open(iv, sealed, aad).toString(), data);
+    }
+  }
+
+  // KeyObjects and different authentication tag lengths are supported.
+  {
+    const keyObject = crypto.createSecretKey(key);
+    const short = crypto.createAEAD(cipher, keyObject, { authTagLength: 12 });
+    const sealed = short.seal(iv, 'hello');
+    assert.strictEqual(sealed.length, 5 + 12);
+    assert.deepStrictEqual(
+      sealed, legacySeal(cipher, key, iv, Buffer.from('hello'), undefined, 12));
+    assert.strictEqual(short.open(iv, sealed).toString(), 'hello');
+  }
+
+  // Tampering with the ciphertext, tag, IV or AAD is detected.
+  {
+    const sealed = aead.seal(iv, 'secret', 'aad');
+    const authError = {
+      message: 'Unsupported state or unable to authenticate data',
+    };
+    for (const index of [0, sealed.length - 1]) {
+      const tampered = Buffer.from(sealed);
+      tampered[index] ^= 1;
+      assert.throws(() => aead.open(iv, tampered, 'aad'), authError);
+    }
+    assert.throws(() => aead.open(iv, sealed, 'aae'), authError);
+    assert.throws(() => aead.open(iv, sealed), authError);
+    assert.throws(() => aead.open(crypto.randomBytes(12), sealed, 'aad'),
+                  authError);
+    assert.throws(() => aead.open(iv, sealed.subarray(0, 15), 'aad'),
+                  authError);
+  }
+
+  // Batches.
+  {
+    const messages = [
+      { iv: crypto.randomBytes(12), data: 'first' },
+      { iv: crypto.randomBytes(12), data: Buffer.alloc(0), aad: 'x' },
+      { iv: crypto.randomBytes(12), data: new Uint16Array([1, 2, 3]) },
+      { iv: crypto.randomBytes(12).buffer, data: new ArrayBuffer(40) },
+    ];
+    const sealed = aead.sealBatch(messages);
+    assert.strictEqual(sealed.length, messages.length);
+    for (let i = 0; i < messages.length; i++) {
+      const { iv, data, aad } = messages[i];
+      assert.deepStrictEqual(sealed[i], aead.seal(iv, data, aad));
+    }
+
+    const boxes = sealed.map((data, i) => ({ ...messages[i], data }));
+    boxes[2].data = Buffer.from(boxes[2].data);
+    boxes[2].data[0] ^= 1;
+    const opened = aead.openBatch(boxes);
+    assert.strictEqual(opened[0].toString(), 'first');
+    assert.strictEqual(opened[1].length, 0);
+    assert.strictEqual(opened[2], null);
+    assert.deepStrictEqual(opened[3], Buffer.alloc(40));
+
+    aead.sealBatch(messages, common.mustSucceed((result) => {
+      assert.deepStrictEqual(result, sealed);
+    }));
+    aead.openBatch(boxes, common.mustSucceed((result) => {
+      assert.deepStrictEqual(result, opened);
+    }));
+
+    assert.deepStrictEqual(aead.sealBatch([]), []);
+    assert.deepStrictEqual(aead.openBatch([]), []);
+  }
+}
+
+{
+  const aead = crypto.createAEAD('aes-256-gcm', crypto.randomBytes(32));
+  const iv = crypto.randomBytes(12);
+
+  // GCM supports IVs of other lengths, ChaCha20-Poly1305 does not.
+  const longIV = crypto.randomBytes(16);
+  assert.strictEqual(aead.open(longIV, aead.seal(longIV, 'a')).toString(), 'a');
+  const chacha = crypto.createAEAD('chacha20-poly1305', crypto.randomBytes(32));
+  assert.throws(() => chacha.seal(longIV, 'a'), {
+    code: 'ERR_CRYPTO_INVALID_IV',
+  });
+  assert.throws(() => aead.seal(Buffer.alloc(0), 'a'), {
+    code: 'ERR_CRYPTO_INVALID_IV',
+  });
+  assert.throws(() => aead.sealBatch([
+    { iv, data: 'a' },
+    { iv: '', data: 'b' },
+  ]), { code: 'ERR_CRYPTO_INVALID_IV' });
+
+  assert.throws(() => aead.seal(iv, 1), { code: 'ERR_INVALID_ARG_TYPE' });
+  assert.throws(() => aead.sealBatch('a'), { code: 'ERR_INVALID_ARG_TYPE' });
+  assert.throws(() => aead.sealBatch([null]), { code: 'ERR_INVALID_ARG_TYPE' });
+  assert.throws(() => aead.sealBatch([{ iv }]), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    message: /messages\[0\]\.data/,
+  });
+  assert.throws(() => aead.sealBatch([], 'callback'), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+}
+
+// Invalid construction arguments.
+{
+  assert.throws(() => crypto.createAEAD('aes-256-cbc', Buffer.alloc(32)), {
+    code: 'ERR_CRYPTO_UNSUPPORTED_OPERATION',
+  });
+  assert.throws(() => crypto.createAEAD('aes-256-ccm', Buffer.alloc(32)), {
+    code: 'ERR_CRYPTO_UNSUPPORTED_OPERATION',
+  });
+  assert.throws(() => crypto.createAEAD('nope', Buffer.alloc(32)), {
+    code: 'ERR_CRYPTO_UNKNOWN_CIPHER',
+  });
+  assert.throws(() => crypto.createAEAD('aes-256-gcm', Buffer.alloc(16)), {
+    code: 'ERR_CRYPTO_INVALID_KEYLEN',
+  });
+  for (const authTagLength of [0, 3, 17]) {
+    assert.throws(() => crypto.createAEAD('aes-256-gcm', Buffer.alloc(32), {
+      authTagLength,
+    }), { code: 'ERR_CRYPTO_INVALID_AUTH_TAG' });
+  }
+  assert.throws(() => crypto.createAEAD('aes-256-gcm', Buffer.alloc(32), {
+    authTagLength: -1,
+  }), { code: 'ERR_OUT_OF_RANGE' });
+  assert.throws(() => crypto.createAEAD(1, Buffer.alloc(32)), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+}
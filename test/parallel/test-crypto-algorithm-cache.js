@@ -0,0 +1,48 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Digest and cipher implementations are looked up once per process and shared
+// by all threads. Check that aliases of the same algorithm, and lookups from
+// several threads at once, all produce the same results.
+const assert = require('assert');
+const crypto = require('crypto');
+const { Worker, isMainThread, parentPort } = require('worker_threads');
+
+function run() {
+  const key = Buffer.alloc(16, 1);
+  const iv = Buffer.alloc(16, 2);
+  const results = [];
+  for (let i = 0; i < 50; i++) {
+    for (const digest of ['sha256', 'SHA256', 'RSA-SHA256', 'sha1', 'md5']) {
+      results.push(crypto.createHash(digest).update('data').digest('hex'));
+      results.push(crypto.createHmac(digest, key).update('data').digest('hex'));
+      results.push(
+        Buffer.from(crypto.pbkdf2Sync('pass', 'salt', 1, 16, digest))
+          .toString('hex'));
+    }
+    for (const cipher of ['aes-128-cbc', 'AES-128-CBC', 'aes128']) {
+      const c = crypto.createCipheriv(cipher, key, iv);
+      results.push(Buffer.concat([c.update('data'), c.final()]).toString('hex'));
+      assert.strictEqual(crypto.getCipherInfo(cipher).name, 'aes-128-cbc');
+    }
+  }
+  return results;
+}
+
+if (isMainThread) {
+  const expected = run();
+  // Aliases resolve to the same implementation.
+  assert.strictEqual(expected[0], expected[3]);
+  assert.strictEqual(expected[0], expected[6]);
+  assert.strictEqual(expected[15], expected[16]);
+
+  for (let i = 0; i < 4; i++) {
+    new Worker(__filename).on('message', common.mustCall((results) => {
+      assert.deepStrictEqual(results, expected);
+    }));
+  }
+} else {
+  parentPort.postMessage(run());
+}
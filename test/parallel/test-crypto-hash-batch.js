@@ -0,0 +1,97 @@
+'use strict';
+// This tests crypto.hashBatch() works.
+const common = require('../common');
+
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+function expected(algorithm, inputs) {
+  return Buffer.concat(inputs.map(
+    (input) => crypto.createHash(algorithm).update(input).digest()));
+}
+
+const inputs = [
+  'abc',
+  '',
+  Buffer.from('hello world'),
+  new Uint16Array([1, 2, 3]),
+  new DataView(new ArrayBuffer(7)),
+  'ünïcödé',
+  'x'.repeat(10000),
+];
+
+for (const algorithm of ['md5', 'sha1', 'sha256', 'sha512']) {
+  const digests = crypto.hashBatch(algorithm, inputs);
+  assert(Buffer.isBuffer(digests));
+  assert.deepStrictEqual(digests, expected(algorithm, inputs));
+
+  crypto.hashBatch(algorithm, inputs, common.mustSucceed((digests) => {
+    assert(Buffer.isBuffer(digests));
+    assert.deepStrictEqual(digests, expected(algorithm, inputs));
+  }));
+}
+
+// Every slice of the result matches crypto.hash().
+{
+  const digests = crypto.hashBatch('sha256', ['a', 'b']);
+  assert.strictEqual(digests.length, 64);
+  assert.deepStrictEqual(digests.subarray(32),
+                         crypto.hash('sha256', 'b', 'buffer'));
+}
+
+// An empty batch produces an empty result.
+assert.deepStrictEqual(crypto.hashBatch('sha256', []), Buffer.alloc(0));
+crypto.hashBatch('sha256', [], common.mustSucceed((digests) => {
+  assert.strictEqual(digests.length, 0);
+}));
+
+// A single buffer with offsets.
+{
+  const data = Buffer.from('aaabbbbcc');
+  const parts = ['aaa', 'bbbb', 'cc', ''];
+  for (const offsets of [[0, 3, 7, 9, 9], new Uint32Array([0, 3, 7, 9, 9])]) {
+    assert.deepStrictEqual(crypto.hashBatch('sha1', data, { offsets }),
+                           expected('sha1', parts));
+  }
+  // Offsets do not have to start at zero or cover the whole buffer.
+  assert.deepStrictEqual(crypto.hashBatch('sha1', data, { offsets: [3, 7] }),
+                         expected('sha1', ['bbbb']));
+  crypto.hashBatch('sha1', data, { offsets: [0, 3, 7] },
+                   common.mustSucceed((digests) => {
+                     assert.deepStrictEqual(digests,
+                                            expected('sha1', ['aaa', 'bbbb']));
+                   }));
+}
+
+// Invalid arguments.
+assert.throws(() => crypto.hashBatch(1, []),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha1', 'abc'),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha1', ['abc', 1]),
+              { code: 'ERR_INVALID_ARG_TYPE', message: /data\[1\]/ });
+assert.throws(() => crypto.hashBatch('sha1', [], 'options'),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha1', [], {}, 'callback'),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha1', Buffer.alloc(4)),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha1', Buffer.alloc(4), { offsets: [] }),
+              { code: 'ERR_INVALID_ARG_VALUE' });
+assert.throws(() => crypto.hashBatch('sha1', Buffer.alloc(4),
+                                     { offsets: [0, 3, 2] }),
+              { code: 'ERR_INVALID_ARG_VALUE' });
+assert.throws(() => crypto.hashBatch('sha1', Buffer.alloc(4),
+                                     { offsets: [0, 5] }),
+              { code: 'ERR_OUT_OF_RANGE' });
+assert.throws(() => crypto.hashBatch('sha1', Buffer.alloc(4),
+                                     { offsets: [0, -1] }),
+              { code: 'ERR_OUT_OF_RANGE' });
+assert.throws(() => crypto.hashBatch('not a hash', ['abc']),
+              { code: 'ERR_CRYPTO_INVALID_DIGEST' });
+assert.throws(() => crypto.hashBatch('not a hash', ['abc'],
+                                     common.mustNotCall()),
+              { code: 'ERR_CRYPTO_INVALID_DIGEST' });
@@ -0,0 +1,87 @@
+'use strict';
+// This tests crypto.hash() works.
+const common = require('../common');
+
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const fixtures = require('../common/fixtures');
+const fs = require('fs');
+
+// Test errors for invalid arguments.
+[undefined, null, true, 1, () => {}, {}].forEach((invalid) => {
+  assert.throws(() => { crypto.hash(invalid, 'test'); },
+                { code: 'ERR_INVALID_ARG_TYPE' });
+});
+
+[undefined, null, true, 1, () => {}, {}].forEach((invalid) => {
+  assert.throws(() => { crypto.hash('sha1', invalid); },
+                { code: 'ERR_INVALID_ARG_TYPE' });
+});
+
+[null, true, 1, () => {}, {}].forEach((invalid) => {
+  assert.throws(() => { crypto.hash('sha1', 'test', invalid); },
+                { code: 'ERR_INVALID_ARG_TYPE' });
+});
+
+assert.throws(() => { crypto.hash('sha1', 'test', 'not an encoding'); },
+              { code: 'ERR_INVALID_ARG_VALUE' });
+
+assert.throws(() => { crypto.hash('not a hash', 'test'); },
+              { message: /Digest method not supported/ });
+
+const input = fs.readFileSync(fixtures.path('sample.png'));
+[
+  'blake2b512',
+  'md5',
+  'sha1',
+  'sha256',
+  'sha512',
+  'RSA-SHA256',
+  'SHA256',
+].forEach((method) => {
+  if (!crypto.getHashes().includes(method.toLowerCase()) &&
+      !crypto.getHashes().includes(method)) {
+    return;
+  }
+  for (const inputEncoding of ['buffer', 'latin1', 'utf8']) {
+    const data = inputEncoding === 'buffer' ?
+      input : input.toString(inputEncoding);
+    const oldDigest = crypto.createHash(method).update(data).digest('hex');
+    const digestFromBuffer = crypto.hash(method, input);
+    assert.deepStrictEqual(digestFromBuffer,
+                           crypto.createHash(method).update(input)
+                             .digest('hex'));
+    const digest = crypto.hash(method, data);
+    assert.deepStrictEqual(digest, oldDigest);
+
+    for (const outputEncoding of ['hex', 'base64', 'latin1', 'BASE64URL']) {
+      const oldDigest =
+        crypto.createHash(method).update(data).digest(outputEncoding);
+      const digest = crypto.hash(method, data, outputEncoding);
+      assert.deepStrictEqual(digest, oldDigest);
+    }
+
+    const oldBuffer = crypto.createHash(method).update(data).digest();
+    const buffer = crypto.hash(method, data, 'buffer');
+    assert(Buffer.isBuffer(buffer));
+    assert.deepStrictEqual(buffer, oldBuffer);
+  }
+});
+
+// Empty input and typed arrays that are views into larger buffers.
+assert.strictEqual(
+  crypto.hash('sha256', ''),
+  crypto.createHash('sha256').digest('hex'));
+{
+  const backing = Buffer.from('xxhelloxx');
+  const view = new Uint8Array(backing.buffer, backing.byteOffset + 2, 5);
+  assert.strictEqual(
+    crypto.hash('sha256', view),
+    crypto.createHash('sha256').update('hello').digest('hex'));
+  const dataView = new DataView(backing.buffer, backing.byteOffset + 2, 5);
+  assert.strictEqual(crypto.hash('sha256', dataView),
+                     crypto.hash('sha256', view));
+}
@@ -0,0 +1,62 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Small synchronous random requests are served from a per-thread pool. Make
+// sure that the pool never hands out the same bytes twice and only writes to
+// the requested range.
+
+const assert = require('assert');
+const crypto = require('crypto');
+const { Worker, isMainThread } = require('worker_threads');
+
+{
+  const seen = new Set();
+  for (let i = 0; i < 4096; i++) {
+    const hex = crypto.randomBytes(16).toString('hex');
+    assert(!seen.has(hex));
+    seen.add(hex);
+  }
+}
+
+{
+  const buf = Buffer.alloc(64);
+  crypto.randomFillSync(buf, 16, 32);
+  assert.deepStrictEqual(buf.subarray(0, 16), Buffer.alloc(16));
+  assert.deepStrictEqual(buf.subarray(48), Buffer.alloc(16));
+  assert.notDeepStrictEqual(buf.subarray(16, 48), Buffer.alloc(32));
+}
+
+{
+  const ab = new ArrayBuffer(64);
+  crypto.randomFillSync(ab, 8, 8);
+  const view = new Uint8Array(ab);
+  assert.deepStrictEqual(view.subarray(0, 8), new Uint8Array(8));
+  assert.deepStrictEqual(view.subarray(16), new Uint8Array(48));
+}
+
+{
+  const arr = new Uint32Array(16);
+  crypto.randomFillSync(arr, 4, 4);
+  assert.deepStrictEqual(arr.subarray(0, 4), new Uint32Array(4));
+  assert.deepStrictEqual(arr.subarray(8), new Uint32Array(8));
+  assert.notDeepStrictEqual(arr.subarray(4, 8), new Uint32Array(4));
+}
+
+{
+  // Requests that straddle a pool refill still produce fresh data.
+  const a = Buffer.concat(Array.from({ length: 64 }, () => crypto.randomBytes(100)));
+  const b = Buffer.concat(Array.from({ length: 64 }, () => crypto.randomBytes(100)));
+  assert.notDeepStrictEqual(a, b);
+}
+
+{
+  const values = crypto.getRandomValues(new Uint16Array(8));
+  assert.notDeepStrictEqual(values, new Uint16Array(8));
+}
+
+if (isMainThread) {
+  const worker = new Worker(__filename);
+  worker.on('exit', common.mustCall((code) => assert.strictEqual(code, 0)));
+}
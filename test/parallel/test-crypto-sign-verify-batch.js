@@ -0,0 +1,175 @@
+'use strict';
+// This tests crypto.signBatch() and crypto.verifyBatch() work.
+const common = require('../common');
+
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const fixtures = require('../common/fixtures');
+
+const inputs = [
+  'abc',
+  '',
+  Buffer.from('hello world'),
+  new Uint16Array([1, 2, 3]),
+  new DataView(new ArrayBuffer(7)),
+  'ünïcödé',
+  'x'.repeat(10000),
+];
+
+function toBuffer(input) {
+  if (typeof input === 'string')
+    return Buffer.from(input);
+  return Buffer.from(input.buffer, input.byteOffset, input.byteLength);
+}
+
+const keys = [
+  { algorithm: 'sha256',
+    private: fixtures.readKey('rsa_private_2048.pem', 'ascii'),
+    public: fixtures.readKey('rsa_public_2048.pem', 'ascii') },
+  { algorithm: 'sha256',
+    private: fixtures.readKey('ec_p256_private.pem', 'ascii'),
+    public: fixtures.readKey('ec_p256_public.pem', 'ascii') },
+  { algorithm: null,
+    private: fixtures.readKey('ed25519_private.pem', 'ascii'),
+    public: fixtures.readKey('ed25519_public.pem', 'ascii') },
+];
+
+for (const { algorithm, private: privateKey, public: publicKey } of keys) {
+  const signatures = crypto.signBatch(algorithm, inputs, privateKey);
+  assert.strictEqual(signatures.length, inputs.length);
+  for (let i = 0; i < inputs.length; i++) {
+    assert(Buffer.isBuffer(signatures[i]));
+    assert.strictEqual(
+      crypto.verify(algorithm, toBuffer(inputs[i]), publicKey, signatures[i]),
+      true);
+  }
+
+  assert.deepStrictEqual(
+    crypto.verifyBatch(algorithm, inputs, publicKey, signatures),
+    inputs.map(() => true));
+
+  // A private key can be used to verify as well.
+  assert.deepStrictEqual(
+    crypto.verifyBatch(algorithm, inputs, privateKey, signatures),
+    inputs.map(() => true));
+
+  // Only the tampered signature fails to verify.
+  const tampered = signatures.map((signature) => Buffer.from(signature));
+  tampered[2][0] ^= 1;
+  const results = crypto.verifyBatch(algorithm, inputs, publicKey, tampered);
+  assert.deepStrictEqual(results, inputs.map((_, i) => i !== 2));
+
+  crypto.signBatch(algorithm, inputs, privateKey,
+                   common.mustSucceed((signatures) => {
+                     assert.strictEqual(signatures.length, inputs.length);
+                     crypto.verifyBatch(
+                       algorithm, inputs, publicKey, signatures,
+                       common.mustSucceed((results) => {
+                         assert.deepStrictEqual(
+                           results, inputs.map(() => true));
+                       }));
+                   }));
+}
+
+// Options are applied to every item, and IEEE-P1363 signatures are supported.
+{
+  const privateKey = fixtures.readKey('ec_p256_private.pem', 'ascii');
+  const publicKey = fixtures.readKey('ec_p256_public.pem', 'ascii');
+  const signatures = crypto.signBatch(
+    'sha256', inputs, { key: privateKey, dsaEncoding: 'ieee-p1363' });
+  for (const signature of signatures)
+    assert.strictEqual(signature.length, 64);
+  assert.deepStrictEqual(
+    crypto.verifyBatch(
+      'sha256', inputs, { key: publicKey, dsaEncoding: 'ieee-p1363' },
+      signatures),
+    inputs.map(() => true));
+  assert.deepStrictEqual(
+    crypto.verifyBatch('sha256', inputs, publicKey, signatures),
+    inputs.map(() => false));
+}
+
+{
+  const privateKey = fixtures.readKey('rsa_private_2048.pem', 'ascii');
+  const publicKey = fixtures.readKey('rsa_public_2048.pem', 'ascii');
+  const options = {
+    padding: crypto.constants.RSA_PKCS1_PSS_PADDING,
+    saltLength: 32,
+  };
+  const signatures = crypto.signBatch(
+    'sha256', inputs, { key: privateKey, ...options });
+  for (let i = 0; i < inputs.length; i++) {
+    assert.strictEqual(
+      crypto.verify('sha256', toBuffer(inputs[i]),
+                    { key: publicKey, ...options }, signatures[i]),
+      true);
+  }
+  assert.deepStrictEqual(
+    crypto.verifyBatch('sha256', inputs, { key: publicKey, ...options },
+                       signatures),
+    inputs.map(() => true));
+}
+
+// Empty batches.
+{
+  const privateKey = fixtures.readKey('ed25519_private.pem', 'ascii');
+  const publicKey = fixtures.readKey('ed25519_public.pem', 'ascii');
+  assert.deepStrictEqual(crypto.signBatch(null, [], privateKey), []);
+  assert.deepStrictEqual(crypto.verifyBatch(null, [], publicKey, []), []);
+}
+
+// Repeated calls with the same key material give consistent results, also
+// with keys that are not cached because they are encrypted.
+{
+  const privateKey = fixtures.readKey('rsa_private_2048.pem', 'ascii');
+  const publicKey = fixtures.readKey('rsa_public_2048.pem', 'ascii');
+  for (let i = 0; i < 3; i++) {
+    const signature = crypto.sign('sha256', Buffer.from('abc'), privateKey);
+    assert(crypto.verify('sha256', Buffer.from('abc'), publicKey, signature));
+  }
+
+  const encrypted = {
+    key: fixtures.readKey('rsa_private_encrypted.pem', 'ascii'),
+    passphrase: 'password',
+  };
+  const signature = crypto.sign('sha256', Buffer.from('abc'), encrypted);
+  assert(crypto.verify('sha256', Buffer.from('abc'), encrypted, signature));
+  assert.throws(() => crypto.sign('sha256', Buffer.from('abc'), {
+    ...encrypted, passphrase: 'wrong',
+  }), /bad decrypt/);
+}
+
+{
+  const privateKey = fixtures.readKey('ed25519_private.pem', 'ascii');
+  const publicKey = fixtures.readKey('ed25519_public.pem', 'ascii');
+
+  for (const data of ['abc', Buffer.from('abc'), {}, undefined]) {
+    assert.throws(() => crypto.signBatch(null, data, privateKey), {
+      code: 'ERR_INVALID_ARG_TYPE',
+    });
+  }
+  assert.throws(() => crypto.signBatch(null, ['abc', 1], privateKey), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    message: /"data\[1\]"/,
+  });
+  assert.throws(() => crypto.signBatch(null, ['abc']), {
+    code: 'ERR_CRYPTO_SIGN_KEY_REQUIRED',
+  });
+  assert.throws(() => crypto.signBatch(null, ['abc'], privateKey, 'cb'), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+
+  assert.throws(() => crypto.verifyBatch(null, ['abc'], publicKey, []), {
+    code: 'ERR_OUT_OF_RANGE',
+  });
+  assert.throws(() => crypto.verifyBatch(null, ['abc'], publicKey, 'sig'), {
+    code: 'ERR_INVALID_ARG_TYPE',
+  });
+  assert.throws(() => crypto.verifyBatch(null, ['abc'], publicKey, ['sig']), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    message: /"signatures\[0\]"/,
+  });
+}
@@ -2,10 +2,11 @@
 'use strict';
 require('../common');
 const fixtures = require('../common/fixtures');
+const tmpdir = require('../common/tmpdir');
 const { internalBinding } = require('internal/test/binding');
 const { filterOwnProperties } = require('internal/util');
 const { internalModuleReadJSON } = internalBinding('fs');
-const { readFileSync } = require('fs');
+const { readFileSync, writeFileSync } = require('fs');
 const { strictEqual, deepStrictEqual } = require('assert');
 
 {
@@ -19,11 +20,46 @@ const { strictEqual, deepStrictEqual } = require('assert');
 }
 {
   const filename = fixtures.path('require-bin/package.json');
-  const returnValue = JSON.parse(internalModuleReadJSON(filename)[0]);
+  const {
+    2: name, 3: main, 4: exports, 5: imports, 6: type,
+  } = internalModuleReadJSON(filename);
+  const returnValue = { name, main, exports, imports, type };
   const file = JSON.parse(readFileSync(filename, 'utf-8'));
   const expectedValue = filterOwnProperties(file, ['name', 'main', 'exports', 'imports', 'type']);
-  deepStrictEqual({
-    __proto__: null,
-    ...returnValue,
-  }, expectedValue);
+  deepStrictEqual(filterOwnProperties(returnValue, Object.keys(expectedValue)), expectedValue);
+  strictEqual(internalModuleReadJSON(filename)[0], undefined);
+  strictEqual(internalModuleReadJSON(filename, true)[0], readFileSync(filename, 'utf-8'));
+}
+{
+  // Only the fields used for resolution are extracted, and exports and
+  // imports are returned as JSON text.
+  tmpdir.refresh();
+  const filename = tmpdir.resolve('package.json');
+  const exportsValue = { '.': { import: './a.mjs', require: ['./a.js', null] } };
+  writeFileSync(filename, `{
+    "name": "n\\u00e4me \\ud83d\\ude00",
+    "main": 42,
+    "exports": ${JSON.stringify(exportsValue)},
+    "imports": { "#dep": "./dep.js" },
+    "type": "module",
+    "dependencies": { "dep": "1.0.0" }
+  }`);
+  const returnValue = internalModuleReadJSON(filename);
+  strictEqual(returnValue.length, 7);
+  strictEqual(returnValue[2], 'n\u00e4me \ud83d\ude00');
+  strictEqual(returnValue[3], undefined);
+  deepStrictEqual(JSON.parse(returnValue[4]), exportsValue);
+  deepStrictEqual(JSON.parse(returnValue[5]), { '#dep': './dep.js' });
+  strictEqual(returnValue[6], 'module');
+
+  // The last of duplicated keys wins, like with JSON.parse().
+  writeFileSync(filename, '{ "main": "a.js", "exports": null, "main": "b.js" }');
+  deepStrictEqual(internalModuleReadJSON(filename).slice(2),
+                  [undefined, 'b.js', 'null', undefined, undefined]);
+
+  // Invalid JSON is returned as a string, for JSON.parse() to report the error.
+  for (const source of ['{ "main": "a.js", }', '["main"]', '{ "main": "\\ud800" }']) {
+    writeFileSync(filename, source);
+    deepStrictEqual(internalModuleReadJSON(filename), [source, true]);
+  }
 }
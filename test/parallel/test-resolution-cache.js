@@ -0,0 +1,87 @@
+'use strict';
+
+// This tests that NODE_RESOLUTION_CACHE persists the file system lookups of
+// module resolution, and that they are discarded when the file system has
+// changed since.
+
+require('../common');
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+const { expectSyncExitWithoutError } = require('../common/child_process');
+const tmpdir = require('../common/tmpdir');
+const fs = require('fs');
+const path = require('path');
+
+tmpdir.refresh();
+const cacheFile = tmpdir.resolve('resolution.cache');
+const nodeModules = tmpdir.resolve('node_modules');
+
+function writePackage(name, pjson, files) {
+  const dir = path.join(nodeModules, name);
+  fs.mkdirSync(dir, { recursive: true });
+  fs.writeFileSync(path.join(dir, 'package.json'), JSON.stringify(pjson));
+  for (const [file, source] of Object.entries(files)) {
+    fs.mkdirSync(path.dirname(path.join(dir, file)), { recursive: true });
+    fs.writeFileSync(path.join(dir, file), source);
+  }
+}
+
+writePackage('pkg', { main: 'a.js' }, {
+  'a.js': 'module.exports = "a";',
+  'lib/b.js': 'module.exports = "b";',
+});
+fs.writeFileSync(tmpdir.resolve('main.js'), `
+const { flushResolutionCache } = require('node:module');
+const fs = require('fs');
+const result = { pkg: require('pkg') };
+try {
+  result.other = require('other');
+} catch (err) {
+  result.other = err.code;
+}
+import('esm').then(({ default: value }) => {
+  result.esm = value;
+}, (err) => {
+  result.esm = err.code;
+}).then(() => {
+  flushResolutionCache();
+  result.written = fs.existsSync(process.env.NODE_RESOLUTION_CACHE);
+  console.log(JSON.stringify(result));
+});
+`);
+
+function run() {
+  const { stdout } = expectSyncExitWithoutError(
+    spawnSync(process.execPath, [tmpdir.resolve('main.js')], {
+      cwd: tmpdir.path,
+      env: { ...process.env, NODE_RESOLUTION_CACHE: cacheFile },
+    }), {});
+  return JSON.parse(stdout.toString());
+}
+
+const notFound = {
+  pkg: 'a',
+  other: 'MODULE_NOT_FOUND',
+  esm: 'ERR_MODULE_NOT_FOUND',
+  written: true,
+};
+assert.deepStrictEqual(run(), notFound);
+assert.deepStrictEqual(run(), notFound);
+
+// A changed package.json is read again.
+writePackage('pkg', { main: 'lib/b.js' }, {});
+assert.deepStrictEqual(run(), { ...notFound, pkg: 'b' });
+
+// So are the lookups of a directory that packages have been added to.
+writePackage('other', {}, { 'index.js': 'module.exports = "other";' });
+writePackage('esm', { type: 'module', exports: './index.js' }, {
+  'index.js': 'export default "esm";',
+});
+const found = { pkg: 'b', other: 'other', esm: 'esm', written: true };
+assert.deepStrictEqual(run(), found);
+assert.deepStrictEqual(run(), found);
+
+// A corrupted cache file is ignored and written again.
+fs.appendFileSync(cacheFile, 'garbage');
+assert.deepStrictEqual(run(), found);
+assert.deepStrictEqual(run(), found);
@@ -0,0 +1,69 @@
+'use strict';
+
+// This tests that CommonJS modules required by the entry point while building
+// a snapshot are included in it, and can be required again after the
+// snapshot is deserialized even when their sources are gone.
+
+require('../common');
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+const tmpdir = require('../common/tmpdir');
+const fixtures = require('../common/fixtures');
+const path = require('path');
+const fs = require('fs');
+
+tmpdir.refresh();
+const blobPath = path.join(tmpdir.path, 'snapshot.blob');
+const appPath = path.join(tmpdir.path, 'app');
+fs.cpSync(fixtures.path('snapshot', 'user-modules'), appPath,
+          { recursive: true });
+
+{
+  const child = spawnSync(process.execPath, [
+    '--snapshot-blob',
+    blobPath,
+    '--build-snapshot',
+    path.join(appPath, 'entry.js'),
+  ], {
+    cwd: tmpdir.path
+  });
+  if (child.status !== 0) {
+    console.log(child.stderr.toString());
+    console.log(child.stdout.toString());
+    assert.strictEqual(child.status, 0);
+  }
+  const stats = fs.statSync(blobPath);
+  assert(stats.isFile());
+}
+
+fs.rmSync(appPath, { recursive: true });
+
+{
+  const child = spawnSync(process.execPath, [
+    '--snapshot-blob',
+    blobPath,
+  ], {
+    cwd: tmpdir.path
+  });
+  if (child.status !== 0) {
+    console.log(child.stderr.toString());
+    console.log(child.stdout.toString());
+    assert.strictEqual(child.status, 0);
+  }
+  // Setting up the module loaders again must not trip over the modules that
+  // were restored from the snapshot.
+  assert.strictEqual(child.stdout.toString().trim(),
+                     'hello snapshot, hello deserialized\nsame module: true');
+}
+
+{
+  // Files that are not snapshot blobs are rejected with an error.
+  const child = spawnSync(process.execPath, [
+    '--snapshot-blob',
+    __filename,
+  ], {
+    cwd: tmpdir.path
+  });
+  assert.strictEqual(child.status, 1);
+  assert.match(child.stderr.toString(), /not a snapshot blob/);
+}
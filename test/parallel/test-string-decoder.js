@@ -108,6 +108,26 @@ for (const expectView of common.getArrayBufferViews(inputBuffer)) {
   assert.strictEqual(decoder.end(), '');
 }
 
+// Long chunks of ASCII, non-ASCII and invalid UTF-8, split at every possible
+// offset within a character.
+{
+  const input = Buffer.concat([
+    Buffer.from('ascii only '.repeat(20)),
+    Buffer.from('Blåbærsyltetøy 蓝莓果酱 🫐🍯 '.repeat(20)),
+    Buffer.from('C9B5A941E2FBCC01EDA0B5EDB08D', 'hex'),
+    Buffer.from('🫐 more text after invalid input '.repeat(20)),
+  ]);
+  const expected = input.toString('utf8');
+  for (const chunkLen of [1, 2, 3, 5, 63, 64, 65, 1000]) {
+    const decoder = new StringDecoder('utf8');
+    let output = '';
+    for (let i = 0; i < input.length; i += chunkLen)
+      output += decoder.write(input.subarray(i, i + chunkLen));
+    output += decoder.end();
+    assert.strictEqual(output, expected, `chunkLen: ${chunkLen}`);
+  }
+}
+
 decoder = new StringDecoder('utf8');
 assert.strictEqual(decoder.write(Buffer.from('E18B', 'hex')), '');
 assert.strictEqual(decoder.end(), '\ufffd');
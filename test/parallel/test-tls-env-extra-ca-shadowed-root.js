@@ -0,0 +1,58 @@
+// A cert in NODE_EXTRA_CA_CERTS with the same subject as a built-in root
+// does not hide that root from TLS peer validation.
+
+'use strict';
+const common = require('../common');
+
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const tls = require('tls');
+const fixtures = require('../common/fixtures');
+
+const { fork } = require('child_process');
+
+// agent11 names the built-in ISRG Root X1 as its issuer, including its
+// authority key identifier, but it is signed with the key of
+// fake-isrg-root-x1. The fake root has the same subject and a different key
+// identifier, so it is never accepted as the issuer. A signature failure
+// means that the chain was built up to the built-in root.
+if (process.env.CHILD) {
+  const client = tls.connect({
+    port: process.env.PORT,
+    servername: 'localhost',
+  }, common.mustNotCall());
+  client.on('error', common.mustCall((err) => {
+    assert.strictEqual(err.code, 'CERT_SIGNATURE_FAILURE');
+  }));
+  return;
+}
+
+const options = {
+  key: fixtures.readKey('agent11-key.pem'),
+  cert: fixtures.readKey('agent11-cert.pem'),
+};
+
+const server = tls.createServer(options, common.mustNotCall());
+server.listen(0, common.mustCall(() => {
+  const env = {
+    ...process.env,
+    CHILD: 'yes',
+    PORT: server.address().port,
+  };
+  delete env.NODE_EXTRA_CA_CERTS;
+  const envWithExtraCA = {
+    ...env,
+    NODE_EXTRA_CA_CERTS: fixtures.path('keys', 'fake-isrg-root-x1-cert.pem'),
+  };
+
+  let pending = 2;
+  for (const childEnv of [env, envWithExtraCA]) {
+    fork(__filename, { env: childEnv }).on('exit', common.mustCall((status) => {
+      assert.strictEqual(status, 0);
+      if (--pending === 0)
+        server.close();
+    }));
+  }
+}));
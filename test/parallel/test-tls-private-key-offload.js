@@ -0,0 +1,118 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Servers with privateKeyOffload perform the handshake signature on the
+// threadpool. Connections must work with all kinds of key exchanges, and the
+// 'keylog' lines of the handshake must not get lost. Handshakes succeed
+// without the offload, too, so the number of signatures that were computed on
+// the threadpool is checked through the secure context.
+
+const assert = require('assert');
+const tls = require('tls');
+const fixtures = require('../common/fixtures');
+
+assert.throws(() => tls.createSecureContext({ privateKeyOffload: 'yes' }), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
+
+const key = fixtures.readKey('agent1-key.pem');
+const cert = fixtures.readKey('agent1-cert.pem');
+
+// OpenSSL does not support async jobs on Android, where the option has no
+// effect.
+const offloadSupported = process.platform !== 'android';
+
+function offloadCount(secureContext) {
+  return secureContext.context.getPrivateKeyOffloadCount();
+}
+
+function test({ serverOptions = {}, clientOptions, offloads }, callback) {
+  let keylogLines = 0;
+  const server = tls.createServer({
+    key,
+    cert,
+    privateKeyOffload: true,
+    ...serverOptions,
+  }, common.mustCall((socket) => {
+    socket.write('hello');
+    socket.on('data', common.mustCall((data) => {
+      assert.strictEqual(data.toString(), 'world');
+      socket.end();
+    }));
+  }));
+
+  server.on('keylog', () => keylogLines++);
+
+  server.listen(0, common.mustCall(() => {
+    const client = tls.connect({
+      port: server.address().port,
+      rejectUnauthorized: false,
+      ...clientOptions,
+    }, common.mustCall(() => {
+      // Written before the server has finished the handshake, for TLSv1.3.
+      client.write('world');
+    }));
+    let received = '';
+    client.setEncoding('utf8');
+    client.on('data', (data) => received += data);
+    client.on('end', common.mustCall(() => {
+      assert.strictEqual(received, 'hello');
+      assert(keylogLines > 0);
+      if (offloadSupported)
+        assert.strictEqual(offloadCount(server._sharedCreds), offloads);
+      server.close(callback);
+    }));
+  }));
+}
+
+const sniContext = tls.createSecureContext({
+  key,
+  cert,
+  privateKeyOffload: true,
+});
+
+const tests = [
+  {
+    clientOptions: { maxVersion: 'TLSv1.3', minVersion: 'TLSv1.3' },
+    offloads: 1,
+  },
+  {
+    clientOptions: {
+      maxVersion: 'TLSv1.2',
+      ciphers: 'ECDHE-RSA-AES128-GCM-SHA256',
+    },
+    offloads: 1,
+  },
+  // RSA key exchange, which decrypts with the original private key and does
+  // not sign anything.
+  {
+    clientOptions: { maxVersion: 'TLSv1.2', ciphers: 'AES128-GCM-SHA256' },
+    offloads: 0,
+  },
+  // The ALPN callback calls into JavaScript, which disables the offload.
+  {
+    serverOptions: { ALPNCallback: common.mustCall(() => 'a') },
+    clientOptions: { ALPNProtocols: ['a'] },
+    offloads: 0,
+  },
+  // So does the certificate callback, but it is done before the offload. The
+  // signature is counted for the context that the callback returned.
+  {
+    serverOptions: {
+      SNICallback: common.mustCall((servername, cb) => cb(null, sniContext)),
+    },
+    clientOptions: { servername: 'agent1' },
+    offloads: 0,
+  },
+];
+
+(function next() {
+  const options = tests.shift();
+  if (options !== undefined) {
+    test(options, common.mustCall(next));
+  } else if (offloadSupported) {
+    assert.strictEqual(offloadCount(sniContext), 1);
+  }
+})();
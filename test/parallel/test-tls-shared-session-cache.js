@@ -0,0 +1,91 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Servers in different threads that use a shared session cache with the same
+// name can resume each other's sessions, both through session IDs and through
+// session tickets.
+
+const assert = require('assert');
+const tls = require('tls');
+const { SSL_OP_NO_TICKET } = require('crypto').constants;
+const fixtures = require('../common/fixtures');
+const { Worker, isMainThread, parentPort, workerData } =
+  require('worker_threads');
+
+function createServer(options) {
+  return tls.createServer({
+    key: fixtures.readKey('agent1-key.pem'),
+    cert: fixtures.readKey('agent1-cert.pem'),
+    sharedSessionCache: 'test',
+    // The default is derived from process.argv, which differs in workers.
+    sessionIdContext: 'test',
+    ...options,
+  }, (socket) => socket.end('x'));
+}
+
+if (!isMainThread) {
+  // The second server runs in a worker and reports its port to the parent.
+  const server = createServer(workerData);
+  server.listen(0, () => parentPort.postMessage(server.address().port));
+  parentPort.once('message', () => server.close());
+  return;
+}
+
+assert.throws(() => tls.createSecureContext({ sharedSessionCache: 1 }), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
+assert.throws(() => tls.getSharedSessionCacheStats(1), {
+  code: 'ERR_INVALID_ARG_TYPE',
+});
+assert.strictEqual(tls.getSharedSessionCacheStats('does not exist'),
+                   undefined);
+
+function connect(port, session, maxVersion, cb) {
+  const client = tls.connect({
+    port,
+    session,
+    maxVersion,
+    rejectUnauthorized: false,
+  }, common.mustCall());
+  let resumed;
+  let newSession;
+  client.on('secureConnect', () => { resumed = client.isSessionReused(); });
+  client.on('session', (session) => { newSession ??= session; });
+  client.resume();
+  client.on('close', common.mustCall(() => cb(resumed, newSession)));
+}
+
+function test(maxVersion, secureOptions, cb) {
+  const options = { maxVersion, secureOptions };
+  const server = createServer(options);
+  server.listen(0, common.mustCall(() => {
+    const worker = new Worker(__filename, { workerData: options });
+    worker.once('message', common.mustCall((workerPort) => {
+      connect(server.address().port, undefined, maxVersion,
+              common.mustCall((resumed, session) => {
+                assert.strictEqual(resumed, false);
+                assert(session);
+                // Resume the session on the server in the worker thread.
+                connect(workerPort, session, maxVersion,
+                        common.mustCall((resumed) => {
+                          assert.strictEqual(resumed, true);
+                          worker.postMessage('close');
+                          server.close(cb);
+                        }));
+              }));
+    }));
+  }));
+}
+
+// Session IDs, which are stored in the cache.
+test('TLSv1.2', SSL_OP_NO_TICKET, common.mustCall(() => {
+  const stats = tls.getSharedSessionCacheStats('test');
+  assert.strictEqual(stats.entries, 1);
+  assert.strictEqual(stats.hits, 1);
+  assert.strictEqual(stats.misses, 0);
+
+  // Session tickets, which are encrypted with the shared ticket keys.
+  test('TLSv1.3', 0, common.mustCall());
+}));
@@ -0,0 +1,65 @@
+// Flags: --allow-natives-syntax --turbo-fast-api-calls --expose-internals
+'use strict';
+
+// This tests that the checks of the types binding return the same results
+// once they are optimized into calls to their fast API variants.
+
+const common = require('../common');
+const assert = require('assert');
+const { internalBinding } = require('internal/test/binding');
+const types = internalBinding('types');
+const { JSStream } = internalBinding('js_stream');
+
+// Each check gets its own function, so that it is optimized with a single
+// known call target.
+function makeCheck(name) {
+  // eslint-disable-next-line no-new-func
+  return new Function('types', `
+    return function ${name}(value) {
+      return types.${name}(value);
+    };
+  `)(types);
+}
+
+function optimize(fn, ...args) {
+  eval('%PrepareFunctionForOptimization(fn)');
+  fn(...args);
+  eval('%OptimizeFunctionOnNextCall(fn)');
+  fn(...args);
+}
+
+(async () => {
+  const values = [
+    undefined, null, 1, 'string', Symbol(), 1n, {}, [], () => {},
+    (new JSStream())._externalStream,
+    new Date(),
+    (function() { return arguments; })(),
+    Object(1n), Object(true), Object(1), Object('string'), Object(Symbol()),
+    new Error(), new TypeError(),
+    /regexp/,
+    async function() {},
+    function*() {}, (function*() {})(),
+    Promise.resolve(), { then() {} },
+    new Map(), new Set(), new Map().keys(), new Set().values(),
+    new WeakMap(), new WeakSet(),
+    new ArrayBuffer(1), new SharedArrayBuffer(1),
+    new DataView(new ArrayBuffer(1)), new Uint8Array(1),
+    new Proxy({}, {}), new Proxy(new Date(), {}),
+    await import('fs'),
+  ];
+
+  const names = Object.keys(types);
+  assert(names.includes('isAnyArrayBuffer'));
+  assert(names.includes('isBoxedPrimitive'));
+  for (const name of names) {
+    const check = makeCheck(name);
+    // The unoptimized function goes through the slow callback.
+    const expected = values.map(check);
+    assert(expected.includes(true), name);
+    assert(expected.includes(false), name);
+
+    optimize(check, values[0]);
+    for (let i = 0; i < values.length; i++)
+      assert.strictEqual(check(values[i]), expected[i], `${name} ${i}`);
+  }
+})().then(common.mustCall());
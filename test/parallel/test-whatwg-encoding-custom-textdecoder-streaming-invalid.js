@@ -0,0 +1,118 @@
+'use strict';
+
+// This tests that streaming TextDecoders produce the same results as decoding
+// the input at once, including for invalid input and byte order marks that
+// are split between chunks.
+
+const common = require('../common');
+
+if (!common.hasIntl)
+  common.skip('missing Intl');
+
+const assert = require('assert');
+
+// Each input is listed with the result of decoding it at once.
+const inputs = {
+  'utf-8': [
+    [[0xEF, 0xBB, 0xBF, 0x41, 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98,
+      0x80],
+     'A\u00e9\u20ac\u{1F600}'],
+    [[0x41, 0xC3, 0x41, 0xE2, 0x82, 0x41, 0xF0, 0x9F, 0x98, 0x41],
+     'A\ufffdA\ufffdA\ufffdA'],
+    [[0xE0, 0x80, 0x80, 0xED, 0xA0, 0x80, 0xF4, 0x90, 0x80, 0x80, 0xC0, 0xFF],
+     '\ufffd'.repeat(12)],
+    [[0x41, 0xF0, 0x9F, 0x98], 'A\ufffd'],
+  ],
+  'utf-16le': [
+    [[0xFF, 0xFE, 0x41, 0x00, 0x3D, 0xD8, 0x00, 0xDE, 0xAC, 0x20],
+     'A\u{1F600}\u20ac'],
+    [[0x00, 0xD8, 0x41, 0x00, 0x00, 0xDC, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xDC],
+     '\ufffdA\ufffd\ufffd\u{10000}'],
+    [[0x41, 0x00, 0x00, 0xD8], 'A\ufffd'],
+    [[0x41, 0x00, 0x42], 'A\ufffd'],
+  ],
+};
+
+for (const [encoding, list] of Object.entries(inputs)) {
+  for (const [bytes, expected] of list) {
+    const input = new Uint8Array(bytes);
+    assert.strictEqual(new TextDecoder(encoding).decode(input), expected,
+                       `${encoding} ${bytes}`);
+    for (let chunkLength = 1; chunkLength <= 5; chunkLength++) {
+      const decoder = new TextDecoder(encoding);
+      let output = '';
+      for (let i = 0; i < input.length; i += chunkLength) {
+        output += decoder.decode(input.subarray(i, i + chunkLength),
+                                 { stream: true });
+      }
+      output += decoder.decode();
+      assert.strictEqual(output, expected,
+                         `${encoding} ${bytes} in chunks of ${chunkLength}`);
+    }
+  }
+}
+
+// Characters that are split between chunks are not errors until the stream
+// ends without completing them.
+for (const [encoding, bytes] of [['utf-8', [0xF0, 0x9F, 0x98, 0x80]],
+                                 ['utf-16le', [0x3D, 0xD8, 0x00, 0xDE]]]) {
+  const decoder = new TextDecoder(encoding, { fatal: true });
+  for (const byte of bytes.slice(0, -1))
+    assert.strictEqual(decoder.decode(new Uint8Array([byte]), { stream: true }),
+                       '');
+  assert.strictEqual(decoder.decode(new Uint8Array(bytes.slice(-1))),
+                     '\u{1F600}');
+
+  decoder.decode(new Uint8Array(bytes.slice(0, -1)), { stream: true });
+  assert.throws(() => decoder.decode(), {
+    code: 'ERR_ENCODING_INVALID_ENCODED_DATA',
+    name: 'TypeError',
+  });
+}
+
+// As in WebIDL, null options are treated like an empty dictionary, so the
+// call ends the stream. This applies to the ICU converters as well.
+for (const [encoding, bytes] of [['utf-8', [0xF0, 0x9F]],
+                                 ['utf-16le', [0x3D, 0xD8]],
+                                 ['shift_jis', [0x82]]]) {
+  const decoder = new TextDecoder(encoding);
+  assert.strictEqual(decoder.decode(new Uint8Array(bytes), { stream: true }),
+                     '');
+  assert.strictEqual(decoder.decode(new Uint8Array(), null), '\ufffd');
+  assert.strictEqual(decoder.decode(new Uint8Array(bytes), null), '\ufffd');
+}
+
+// The decoder can be reused once a stream has ended.
+{
+  const decoder = new TextDecoder('utf-8');
+  const bom = new Uint8Array([0xEF, 0xBB, 0xBF, 0x41]);
+  assert.strictEqual(decoder.decode(bom.subarray(0, 2), { stream: true }), '');
+  assert.strictEqual(decoder.decode(bom.subarray(2)), 'A');
+  assert.strictEqual(decoder.decode(bom), 'A');
+  assert.strictEqual(decoder.decode(new Uint8Array([0xC3]), { stream: true }),
+                     '');
+  assert.strictEqual(decoder.decode(new Uint8Array([0x41])), '\ufffdA');
+}
+
+// All windows-1252 labels decode 0x80 to 0x9F to the characters of the
+// WHATWG index, and every other byte to the code point with the same value.
+{
+  const c1 = [
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+  ];
+  const bytes = new Uint8Array(256).map((byte, i) => i);
+  const expected = String.fromCharCode(
+    ...Array.from(bytes, (byte) => (byte >= 0x80 && byte <= 0x9F ?
+      c1[byte - 0x80] : byte)));
+  for (const label of ['windows-1252', 'latin1', 'ascii']) {
+    assert.strictEqual(new TextDecoder(label).decode(bytes), expected);
+    assert.strictEqual(new TextDecoder(label).decode(Uint8Array.of(0x80)),
+                       '\u20ac');
+    // Input without those bytes takes a different path.
+    assert.strictEqual(new TextDecoder(label).decode(bytes.subarray(0xA0)),
+                       expected.slice(0xA0));
+  }
+}
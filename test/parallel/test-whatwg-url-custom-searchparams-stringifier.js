@@ -24,3 +24,32 @@ const assert = require('assert');
   myUrl.searchParams.sort();
   assert.strictEqual(myUrl.search, '?foo=%7Ebar');
 }
+
+// Everything but ASCII alphanumerics and *-._ is percent-encoded, spaces
+// become '+', and parsing the result gives back the original pairs.
+{
+  let all = '';
+  for (let i = 0; i < 0x80; i++) all += String.fromCharCode(i);
+  all += 'ä\u{1F600}';
+  const params = new URLSearchParams([[all, all], ['', '']]);
+  const serialized = params.toString();
+  assert.match(serialized, /^[\w*.%+=&-]*$/);
+  assert.strictEqual(serialized.split('&').length, 2);
+  assert.deepStrictEqual([...new URLSearchParams(serialized)],
+                         [[all, all], ['', '']]);
+}
+
+// Invalid percent-encoded sequences are kept as they are, and bytes that are
+// not valid UTF-8 are replaced.
+{
+  const params = new URLSearchParams('?a=%zz%4&&b=%ff%e4&c=1+2%2B3&d&=');
+  assert.deepStrictEqual([...params], [
+    ['a', '%zz%4'],
+    ['b', '\ufffd\ufffd'],
+    ['c', '1 2+3'],
+    ['d', ''],
+    ['', ''],
+  ]);
+  assert.strictEqual(params.toString(),
+                     'a=%25zz%254&b=%EF%BF%BD%EF%BF%BD&c=1+2%2B3&d=&=');
+}
@@ -0,0 +1,70 @@
+'use strict';
+
+require('../common');
+const zlib = require('zlib');
+const assert = require('assert');
+const { Buffer } = require('buffer');
+
+// Reference values computed with the portable table-driven algorithm.
+function crc32Reference(buf, crc = 0) {
+  crc = ~crc >>> 0;
+  for (const byte of buf) {
+    crc ^= byte;
+    for (let k = 0; k < 8; k++)
+      crc = (crc & 1) ? (crc >>> 1) ^ 0xEDB88320 : crc >>> 1;
+  }
+  return ~crc >>> 0;
+}
+
+assert.strictEqual(zlib.crc32(''), 0);
+assert.strictEqual(zlib.crc32('hello'), 907060870);
+assert.strictEqual(zlib.crc32('world', zlib.crc32('hello')), 4192936109);
+assert.strictEqual(zlib.crc32(Buffer.from('hello', 'utf16le')), 1427272415);
+assert.strictEqual(zlib.crc32('é'), crc32Reference(Buffer.from('é')));
+
+// Exercise lengths around the thresholds and chunk sizes used by the SIMD
+// kernels, at unaligned offsets.
+{
+  const data = Buffer.alloc(4096 + 7);
+  for (let i = 0; i < data.length; i++)
+    data[i] = (i * 31 + 7) & 0xff;
+  for (const len of [0, 1, 15, 16, 17, 63, 64, 65, 255, 256, 1024, 4096]) {
+    for (const offset of [0, 1, 3]) {
+      const view = data.subarray(offset, offset + len);
+      const expected = crc32Reference(view);
+      assert.strictEqual(zlib.crc32(view), expected);
+      assert.strictEqual(
+        zlib.crc32(new Uint8Array(view.buffer, view.byteOffset, len)),
+        expected);
+      assert.strictEqual(
+        zlib.crc32(new DataView(view.buffer, view.byteOffset, len)),
+        expected);
+      // Computing the checksum incrementally must give the same result.
+      const split = len >>> 1;
+      assert.strictEqual(
+        zlib.crc32(view.subarray(split), zlib.crc32(view.subarray(0, split))),
+        expected);
+    }
+  }
+}
+
+[undefined, null, true, 1, () => {}, {}].forEach((data) => {
+  assert.throws(() => { zlib.crc32(data); }, {
+    code: 'ERR_INVALID_ARG_TYPE',
+    name: 'TypeError',
+  });
+});
+
+[null, true, () => {}, {}].forEach((value) => {
+  assert.throws(() => { zlib.crc32('test', value); }, {
+    code: 'ERR_INVALID_ARG_TYPE',
+    name: 'TypeError',
+  });
+});
+
+[-1, 2 ** 32, 1.5].forEach((value) => {
+  assert.throws(() => { zlib.crc32('test', value); }, {
+    code: 'ERR_OUT_OF_RANGE',
+    name: 'RangeError',
+  });
+});
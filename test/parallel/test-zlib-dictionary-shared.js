@@ -0,0 +1,113 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+const { Worker } = require('worker_threads');
+
+// Tests for zlib.Dictionary, a preset dictionary that can be shared between
+// streams and threads, and for the reuse of native contexts by the one-shot
+// synchronous methods.
+
+const sample = JSON.stringify({ type: 'event', user: 'someone', tags: [] });
+const message = Buffer.from(sample.replace('someone', 'somebody'));
+
+{
+  const dictionary = new zlib.Dictionary(sample);
+  assert.strictEqual(dictionary.size, Buffer.byteLength(sample));
+
+  const compressed = zlib.deflateSync(message, { dictionary });
+  // The dictionary id is the Adler-32 checksum stored in the zlib header.
+  assert.strictEqual(compressed.readUInt32BE(2), dictionary.id);
+  assert.deepStrictEqual(zlib.inflateSync(compressed, { dictionary }),
+                         message);
+
+  // A Dictionary is interchangeable with the same bytes as a Buffer.
+  assert.deepStrictEqual(
+    compressed,
+    zlib.deflateSync(message, { dictionary: Buffer.from(sample) }));
+  assert.deepStrictEqual(
+    zlib.inflateSync(compressed, { dictionary: Buffer.from(sample) }),
+    message);
+
+  // Raw deflate and streams accept it as well.
+  const raw = zlib.deflateRawSync(message, { dictionary });
+  assert.deepStrictEqual(zlib.inflateRawSync(raw, { dictionary }), message);
+
+  zlib.deflate(message, { dictionary }, common.mustSucceed((result) => {
+    assert.deepStrictEqual(result, compressed);
+  }));
+
+  assert.throws(() => zlib.inflateSync(compressed), {
+    code: 'Z_NEED_DICT',
+    message: 'Missing dictionary',
+  });
+}
+
+{
+  // ArrayBuffers and typed arrays are copied when the Dictionary is created.
+  const data = new Uint8Array(Buffer.from(sample));
+  const dictionary = new zlib.Dictionary(data.buffer);
+  data.fill(0);
+  const compressed = zlib.deflateSync(message, { dictionary });
+  assert.deepStrictEqual(
+    zlib.inflateSync(compressed, { dictionary: Buffer.from(sample) }),
+    message);
+
+  for (const invalid of [1, null, undefined, {}, []]) {
+    assert.throws(() => new zlib.Dictionary(invalid), {
+      code: 'ERR_INVALID_ARG_TYPE',
+    });
+  }
+}
+
+{
+  // Repeated one-shot calls reuse native contexts; results must not depend on
+  // what the context was used for previously.
+  const dictionary = new zlib.Dictionary(sample);
+  const expected = zlib.deflateSync(message);
+  const expectedFast = zlib.deflateSync(message, { level: 1 });
+  const expectedDict = zlib.deflateSync(message, { dictionary });
+  for (let i = 0; i < 10; i++) {
+    assert.deepStrictEqual(zlib.deflateSync(message), expected);
+    assert.deepStrictEqual(zlib.deflateSync(message, { level: 1 }),
+                           expectedFast);
+    assert.deepStrictEqual(zlib.deflateSync(message, { dictionary }),
+                           expectedDict);
+    assert.deepStrictEqual(zlib.inflateSync(expected), message);
+    assert.deepStrictEqual(zlib.gunzipSync(zlib.gzipSync(message)), message);
+    assert.deepStrictEqual(zlib.unzipSync(zlib.gzipSync(message)), message);
+    assert.throws(() => zlib.inflateSync(Buffer.from('not zlib data')), {
+      code: 'Z_DATA_ERROR',
+    });
+  }
+
+  // Returned buffers do not alias each other.
+  const first = zlib.inflateSync(expected);
+  const second = zlib.inflateSync(zlib.deflateSync(Buffer.alloc(64, 'x')));
+  assert.deepStrictEqual(first, message);
+  assert.deepStrictEqual(second, Buffer.alloc(64, 'x'));
+}
+
+{
+  // A Dictionary can be sent to a worker without copying its contents.
+  const dictionary = new zlib.Dictionary(sample);
+  const compressed = zlib.deflateSync(message, { dictionary });
+  const worker = new Worker(`
+    const { parentPort } = require('worker_threads');
+    const zlib = require('zlib');
+    parentPort.once('message', ({ dictionary, compressed }) => {
+      parentPort.postMessage({
+        isDictionary: dictionary instanceof zlib.Dictionary,
+        id: dictionary.id,
+        result: zlib.inflateSync(compressed, { dictionary }),
+      });
+    });
+  `, { eval: true });
+  worker.once('message', common.mustCall(({ isDictionary, id, result }) => {
+    assert.strictEqual(isDictionary, true);
+    assert.strictEqual(id, dictionary.id);
+    assert.deepStrictEqual(Buffer.from(result), message);
+    worker.terminate();
+  }));
+  worker.postMessage({ dictionary, compressed });
+}
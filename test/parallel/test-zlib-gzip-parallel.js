@@ -0,0 +1,99 @@
+'use strict';
+// Tests gzip compression with the `parallel` option, which compresses blocks
+// of the input concurrently and stitches them into a single gzip member.
+
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+// Large enough to span several blocks, with enough repetition across block
+// boundaries that the dictionary priming matters.
+const parts = [];
+for (let i = 0; i < 20000; i++)
+  parts.push(`line ${i % 997}: ${'abcdefghij'.repeat(i % 7)}\n`);
+const input = Buffer.from(parts.join(''));
+
+for (const parallel of [1, 2, 4]) {
+  zlib.gzip(input, { parallel }, common.mustSucceed((compressed) => {
+    assert.deepStrictEqual(compressed.subarray(0, 3),
+                           Buffer.from([0x1f, 0x8b, 8]));
+    assert.deepStrictEqual(zlib.gunzipSync(compressed), input);
+    // A single member, so the trailer describes the whole input.
+    assert.strictEqual(compressed.readUInt32LE(compressed.length - 4),
+                       input.length);
+  }));
+}
+
+// The ratio should stay close to that of sequential compression.
+zlib.gzip(input, { parallel: 4 }, common.mustSucceed((compressed) => {
+  const sequential = zlib.gzipSync(input);
+  assert(compressed.length < sequential.length * 1.1,
+         `${compressed.length} vs ${sequential.length}`);
+}));
+
+// Empty input still produces a valid gzip member.
+zlib.gzip(Buffer.alloc(0), { parallel: 2 }, common.mustSucceed((compressed) => {
+  assert.strictEqual(zlib.gunzipSync(compressed).length, 0);
+}));
+
+// Streaming with small writes and explicit flushes.
+{
+  const gzip = zlib.createGzip({ parallel: 3 });
+  const gunzip = zlib.createGunzip();
+  const chunks = [];
+  gzip.pipe(gunzip);
+  gunzip.on('data', (chunk) => chunks.push(chunk));
+  gunzip.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(chunks), input);
+  }));
+
+  let offset = 0;
+  function writeMore() {
+    while (offset < input.length) {
+      const end = Math.min(offset + 7777, input.length);
+      const chunk = input.subarray(offset, end);
+      offset = end;
+      if (offset > input.length / 2 && offset - 7777 <= input.length / 2) {
+        gzip.write(chunk);
+        gzip.flush(zlib.constants.Z_FULL_FLUSH, common.mustCall(writeMore));
+        return;
+      }
+      if (!gzip.write(chunk)) {
+        gzip.once('drain', writeMore);
+        return;
+      }
+    }
+    gzip.end();
+  }
+  writeMore();
+}
+
+// reset() discards the input written so far, including blocks that are
+// still being compressed, and starts a new gzip member.
+{
+  const gzip = zlib.createGzip({ parallel: 2 });
+  const chunks = [];
+  gzip.on('data', (chunk) => chunks.push(chunk));
+  gzip.on('end', common.mustCall(() => {
+    const compressed = Buffer.concat(chunks);
+    assert.deepStrictEqual(zlib.gunzipSync(compressed), input);
+    assert.strictEqual(compressed.readUInt32LE(compressed.length - 4),
+                       input.length);
+  }));
+
+  // One full block is dispatched and the rest is pending.
+  gzip.write(Buffer.alloc(200 * 1024, 'x'));
+  gzip.reset();
+  gzip.end(input);
+}
+
+for (const parallel of [0, -1, 1.5, 1025]) {
+  assert.throws(() => zlib.createGzip({ parallel }), {
+    code: 'ERR_OUT_OF_RANGE',
+    name: 'RangeError',
+  });
+}
+assert.throws(() => zlib.createGzip({ parallel: '2' }), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  name: 'TypeError',
+});
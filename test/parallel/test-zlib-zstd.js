@@ -0,0 +1,135 @@
+'use strict';
+const common = require('../common');
+const fixtures = require('../common/fixtures');
+const assert = require('assert');
+const zlib = require('zlib');
+
+// Test some zstd-specific properties of the zstd streams that can not
+// be easily covered through expanding zlib-only tests.
+
+if (typeof zlib.constants.ZSTD_e_end !== 'number') {
+  // Zstd is only available when built with --shared-zstd.
+  assert.throws(() => zlib.createZstdCompress(), {
+    code: 'ERR_NO_ZSTD',
+    name: 'Error',
+  });
+  common.skip('missing zstd support');
+}
+
+const sampleBuffer = fixtures.readSync('/pss-vectors.json');
+
+{
+  // Test a basic round trip through the sync and async APIs.
+  const encoded = zlib.zstdCompressSync(sampleBuffer);
+  assert(encoded.length < sampleBuffer.length);
+  assert.deepStrictEqual(zlib.zstdDecompressSync(encoded), sampleBuffer);
+
+  zlib.zstdCompress(sampleBuffer, common.mustSucceed((compressed) => {
+    zlib.zstdDecompress(compressed, common.mustSucceed((decompressed) => {
+      assert.deepStrictEqual(decompressed, sampleBuffer);
+    }));
+  }));
+}
+
+{
+  // Test setting the compression level parameter at stream creation:
+  const low = zlib.zstdCompressSync(sampleBuffer, {
+    params: { [zlib.constants.ZSTD_c_compressionLevel]: 1 }
+  });
+  const high = zlib.zstdCompressSync(sampleBuffer, {
+    params: { [zlib.constants.ZSTD_c_compressionLevel]: 19 }
+  });
+  assert(high.length <= low.length, `${high.length} > ${low.length}`);
+}
+
+{
+  // Test that pledgedSrcSize and checksums produce a decodable frame.
+  const encoded = zlib.zstdCompressSync(sampleBuffer, {
+    pledgedSrcSize: sampleBuffer.length,
+    params: { [zlib.constants.ZSTD_c_checksumFlag]: true },
+  });
+  assert.deepStrictEqual(zlib.zstdDecompressSync(encoded), sampleBuffer);
+
+  assert.throws(() => zlib.createZstdCompress({ pledgedSrcSize: -1 }), {
+    code: 'ERR_OUT_OF_RANGE',
+  });
+}
+
+{
+  // Test that setting out-of-bounds option values or keys fails.
+  assert.throws(() => {
+    zlib.createZstdCompress({
+      params: {
+        10000: 0
+      }
+    });
+  }, {
+    code: 'ERR_ZSTD_INVALID_PARAM',
+    name: 'RangeError',
+    message: '10000 is not a valid zstd parameter'
+  });
+
+  // Test that accidentally using duplicate keys fails.
+  assert.throws(() => {
+    zlib.createZstdCompress({
+      params: {
+        '100': 0,
+        '0100': 0
+      }
+    });
+  }, {
+    code: 'ERR_ZSTD_INVALID_PARAM',
+    name: 'RangeError',
+    message: '0100 is not a valid zstd parameter'
+  });
+
+  assert.throws(() => {
+    zlib.createZstdCompress({
+      params: {
+        [zlib.constants.ZSTD_c_compressionLevel]: 'test'
+      }
+    });
+  }, {
+    code: 'ERR_INVALID_ARG_TYPE',
+    name: 'TypeError',
+  });
+
+  // Values the library rejects surface as initialization failures.
+  assert.throws(() => {
+    zlib.createZstdCompress({
+      params: {
+        [zlib.constants.ZSTD_c_strategy]: 1000
+      }
+    });
+  }, {
+    code: 'ERR_ZLIB_INITIALIZATION_FAILED',
+  });
+}
+
+{
+  // Test that truncated input is reported as an error.
+  const encoded = zlib.zstdCompressSync(sampleBuffer);
+  assert.throws(() => {
+    zlib.zstdDecompressSync(encoded.subarray(0, encoded.length - 10));
+  }, {
+    code: 'Z_BUF_ERROR',
+    message: 'unexpected end of file',
+  });
+}
+
+{
+  // Test the web CompressionStream integration.
+  const compressor = new CompressionStream('zstd');
+  const decompressor = new DecompressionStream('zstd');
+  const writer = compressor.writable.getWriter();
+  writer.write(sampleBuffer);
+  writer.close();
+  (async () => {
+    const chunks = [];
+    for await (const chunk of
+      compressor.readable.pipeThrough(decompressor)) {
+      chunks.push(chunk);
+    }
+    assert.deepStrictEqual(Buffer.concat(chunks), sampleBuffer);
+  })().then(common.mustCall());
+}
@@ -0,0 +1,66 @@
+// Flags: --expose-gc --array-buffer-pool-size=1048576
+'use strict';
+
+// This tests that --array-buffer-pool-size reuses the memory of freed
+// ArrayBuffers, and that the reuse is visible in the diagnostic report.
+
+require('../common');
+const assert = require('assert');
+const { spawnSync } = require('child_process');
+const helper = require('../common/report');
+
+{
+  const kSize = 16 * 1024;
+
+  // Allocations that are not garbage yet cannot be served from the pool.
+  const buffers = [];
+  for (let i = 0; i < 32; i++) {
+    const buffer = Buffer.allocUnsafeSlow(kSize);
+    buffer.fill(0xff);
+    buffers.push(buffer);
+  }
+  buffers.length = 0;
+  // The backing stores may be freed concurrently, which the second collection
+  // waits for.
+  global.gc();
+  global.gc();
+
+  // Cached blocks must still be zero-filled when needed.
+  for (let i = 0; i < 32; i++) {
+    const buffer = new ArrayBuffer(kSize - i);
+    assert(new Uint8Array(buffer).every((byte) => byte === 0));
+  }
+
+  const report = process.report.getReport();
+  helper.validateContent(report);
+  const { arrayBufferPool } = report;
+  assert.strictEqual(arrayBufferPool.maxCachedMemory, 1048576);
+  const sizeClass =
+    arrayBufferPool.sizeClasses.find(({ blockSize }) => blockSize === kSize);
+  assert(sizeClass.misses >= 32);
+  assert(sizeClass.hits > 0);
+}
+
+{
+  // The section is omitted when the pool is disabled.
+  const child = spawnSync(process.execPath, [
+    '--array-buffer-pool-size=0',
+    '-p',
+    'JSON.stringify(process.report.getReport())',
+  ]);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  const report = JSON.parse(child.stdout.toString());
+  helper.validateContent(report);
+  assert.strictEqual(report.arrayBufferPool, undefined);
+}
+
+{
+  const child = spawnSync(process.execPath, [
+    '--array-buffer-pool-size=-1',
+    '-e',
+    '',
+  ]);
+  assert.strictEqual(child.status, 9);
+  assert.match(child.stderr.toString(),
+               /--array-buffer-pool-size must not be negative/);
+}
@@ -63,6 +63,7 @@ const customTypesMap = {
   'AsyncResource': 'async_hooks.html#class-asyncresource',
 
   'brotli options': 'zlib.html#class-brotlioptions',
+  'zstd options': 'zlib.html#class-zstdoptions',
 
   'Buffer': 'buffer.html#class-buffer',
 
@@ -70,6 +71,7 @@ const customTypesMap = {
 
   'cluster.Worker': 'cluster.html#class-worker',
 
+  'AEAD': 'crypto.html#class-aead',
   'Cipher': 'crypto.html#class-cipher',
   'Decipher': 'crypto.html#class-decipher',
   'DiffieHellman': 'crypto.html#class-diffiehellman',
@@ -234,6 +236,7 @@ const customTypesMap = {
   'X509Certificate': 'crypto.html#class-x509certificate',
 
   'zlib options': 'zlib.html#class-options',
+  'zlib.Dictionary': 'zlib.html#class-zlibdictionary',
 
   'ReadableStream':
     'webstreams.html#class-readablestream',
@@ -3,8 +3,16 @@
 
 namespace node {
     int Start(int argc, char *argv[]);
+    int Start(int argc, char *argv[],
+              const char *snapshot_blob, size_t snapshot_blob_size);
 } // namespace node
 
 int node_start(int argc, char *argv[]) {
     return node::Start(argc, argv);
 }
+
+int node_start_with_snapshot(int argc, char *argv[],
+                             const char *snapshot_blob,
+                             size_t snapshot_blob_size) {
+    return node::Start(argc, argv, snapshot_blob, snapshot_blob_size);
+}
@@ -1,10 +1,18 @@
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
     
 int node_start(int argc, char *argv[]);
 
+// Starts Node.js from an application snapshot built with
+// `node --snapshot-blob <file> --build-snapshot <entry.js>`, see node::Start().
+int node_start_with_snapshot(int argc, char *argv[],
+                             const char *snapshot_blob,
+                             size_t snapshot_blob_size);
+
 #ifdef __cplusplus
 }
 #endif
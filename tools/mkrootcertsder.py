@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+# Converts the PEM encoded root certificates in src/node_root_certs.h to DER,
+# so that they do not need to be decoded from base64 at runtime, and records
+# where the subject name of each certificate is located, so that certificates
+# can be looked up by subject without parsing them.
+
+import argparse
+import base64
+import re
+import sys
+
+
+def parse_pem(filename):
+  certs = []
+  current = None
+  with open(filename) as f:
+    for line in f:
+      m = re.match(r'^"(.*?)(\\n)?"(,?)$', line.strip())
+      if not m:
+        continue
+      text = m.group(1)
+      if text == '-----BEGIN CERTIFICATE-----':
+        current = []
+      elif text == '-----END CERTIFICATE-----':
+        certs.append(base64.b64decode(''.join(current)))
+        current = None
+      elif current is not None:
+        current.append(text)
+  return certs
+
+
+def read_tlv(data, offset):
+  """Returns (tag, header length, content length) of the DER element at
+  offset."""
+  tag = data[offset]
+  length = data[offset + 1]
+  header = 2
+  if length & 0x80:
+    count = length & 0x7f
+    length = int.from_bytes(data[offset + 2:offset + 2 + count], 'big')
+    header += count
+  return tag, header, length
+
+
+def find_subject(der):
+  # Certificate ::= SEQUENCE { tbsCertificate, ... }
+  tag, header, _ = read_tlv(der, 0)
+  assert tag == 0x30
+  # TBSCertificate ::= SEQUENCE {
+  #   version [0] EXPLICIT OPTIONAL, serialNumber, signature, issuer,
+  #   validity, subject, ... }
+  tag, header2, _ = read_tlv(der, header)
+  assert tag == 0x30
+  offset = header + header2
+  tag, h, length = read_tlv(der, offset)
+  if tag == 0xa0:
+    offset += h + length
+  # Skip serialNumber, signature, issuer and validity.
+  for _ in range(4):
+    tag, h, length = read_tlv(der, offset)
+    offset += h + length
+  tag, h, length = read_tlv(der, offset)
+  assert tag == 0x30
+  return offset, h + length
+
+
+def main():
+  parser = argparse.ArgumentParser()
+  parser.add_argument('input', help='src/node_root_certs.h')
+  parser.add_argument('output')
+  args = parser.parse_args()
+
+  certs = parse_pem(args.input)
+  if not certs:
+    sys.exit('No certificates found in ' + args.input)
+
+  lines = [
+    '// This file is generated by tools/mkrootcertsder.py from',
+    '// src/node_root_certs.h. Do not edit.',
+    '',
+    'static const unsigned char root_certs_der[] = {',
+  ]
+  entries = []
+  offset = 0
+  for der in certs:
+    subject_offset, subject_length = find_subject(der)
+    entries.append((offset, len(der), offset + subject_offset, subject_length))
+    for i in range(0, len(der), 16):
+      lines.append('  ' + ' '.join('0x%02x,' % b for b in der[i:i + 16]))
+    offset += len(der)
+  lines.append('};')
+  lines.append('')
+  lines.append('// { offset, length, subject offset, subject length }, in the '
+               'same order')
+  lines.append('// as the PEM encoded certificates in node_root_certs.h.')
+  lines.append('static const RootCertEntry root_cert_entries[] = {')
+  for entry in entries:
+    lines.append('  { %d, %d, %d, %d },' % entry)
+  lines.append('};')
+  lines.append('')
+
+  with open(args.output, 'w') as f:
+    f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+  main()
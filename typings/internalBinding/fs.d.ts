@@ -107,7 +107,11 @@ declare namespace InternalFSBinding {
   function futimes(fd: number, atime: number, mtime: number, req: undefined, ctx: FSSyncContext): void;
   function futimes(fd: number, atime: number, mtime: number, usePromises: typeof kUsePromises): Promise<void>;
 
-  function internalModuleReadJSON(path: string): [] | [string, boolean];
+  function internalModuleReadJSON(path: string, includeSource?: boolean):
+    [] |
+    [string, boolean] |
+    [string | undefined, boolean, string | undefined, string | undefined,
+     string | undefined, string | undefined, string | undefined];
   function internalModuleStat(path: string): number;
   
   function lchown(path: string, uid: number, gid: number, req: FSReqCallback): void;
@@ -8,5 +8,7 @@ declare function InternalBinding(binding: 'url'): {
   canParse(input: string, base?: string): boolean;
   format(input: string, fragment?: boolean, unicode?: boolean, search?: boolean, auth?: boolean): string;
   parse(input: string, base?: string): string | false;
+  parseSearchParams(input: string): string[];
+  serializeSearchParams(params: string[]): string;
   update(input: string, actionType: typeof urlUpdateActions, value: string): string | false;
 };